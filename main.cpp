@@ -6,8 +6,11 @@
 #include <SDL3/SDL_keycode.h>
 #include <SDL3_image/SDL_image.h>
 #include <SDL3_ttf/SDL_ttf.h>
-#include <iostream>
 #include "src/Core/Game.hpp"
+#include "src/Core/Logger.hpp"
+#include "src/Core/Trace.hpp"
+#include <cstdlib>
+#include <string>
 
 #ifdef _WIN32
     #pragma comment(lib, "SDL3.lib")
@@ -19,26 +22,49 @@
 
 int main(int argc, char* argv[])
 {
-    // Initialize SDL subsystems early
-    if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS) < 0) {
-        std::cerr << "SDL initialization failed: " << SDL_GetError() << std::endl;
-        return 1;
+    // --trace <file>: record timing spans and write a Chrome trace on exit
+    // --record <file>: append a binary record of every finished game
+    // --seed <n>: shuffle the first game's tile bag from a fixed seed
+    // --autosave <file>: resume the game saved there and save after every turn
+    // --load <file>: start from a saved position instead of the menu
+    std::string traceFile;
+    std::string recordFile;
+    std::string seed;
+    std::string autosaveFile;
+    std::string loadFile;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--trace" && i + 1 < argc) {
+            traceFile = argv[++i];
+        } else if (arg == "--record" && i + 1 < argc) {
+            recordFile = argv[++i];
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seed = argv[++i];
+        } else if (arg == "--autosave" && i + 1 < argc) {
+            autosaveFile = argv[++i];
+        } else if (arg == "--load" && i + 1 < argc) {
+            loadFile = argv[++i];
+        } else {
+            LOG_ERROR("Usage: " << argv[0] << " [--trace trace.json] [--record games.scrb] [--seed n]"
+                      << " [--autosave game.sav] [--load position.sav]");
+            return 1;
+        }
     }
-    
-    
-    // Initialize SDL_ttf
-    if (TTF_Init() == -1) {
-        std::cerr << "SDL_ttf initialization failed: " << SDL_GetError() << std::endl;
-        SDL_Quit();
-        return 1;
+    if (!traceFile.empty()) {
+        Trace::setThreadName("main");
+        Trace::enable();
     }
 
+    // SDL and SDL_ttf are initialized once, by Game::initialize and the
+    // renderer it creates, and shut down by Game::cleanup
     Game game;
+    game.setRecordFile(recordFile);
+    if (!seed.empty()) {
+        game.setSeed(static_cast<uint32_t>(std::strtoul(seed.c_str(), nullptr, 10)));
+    }
     
     if (!game.initialize()) {
-        std::cerr << "Failed to initialize game!" << std::endl;
-        TTF_Quit();
-        SDL_Quit();
+        LOG_ERROR("Failed to initialize game!");
         return 1;
     }
     
@@ -50,8 +76,21 @@ int main(int argc, char* argv[])
     //     return 1;
     // }
 
-    std::cout << "Game initialized successfully!" << std::endl;
-    std::cout << "Starting with menu screen..." << std::endl;
+    LOG_INFO("Game initialized successfully!");
+
+    // An autosave left behind means the last session never finished its game
+    game.setAutosaveFile(autosaveFile);
+    const bool resumed = !loadFile.empty() ? game.loadGame(loadFile)
+                                           : !autosaveFile.empty() && game.loadGame(autosaveFile);
+    if (!loadFile.empty() && !resumed) {
+        LOG_ERROR("Failed to load saved position: " << loadFile);
+        game.cleanup();
+        Logger::instance().shutdown();
+        return 1;
+    }
+    if (!resumed) {
+        LOG_INFO("Starting with menu screen...");
+    }
     
     
     /* Option 2: Human vs AI (testing)
@@ -76,8 +115,11 @@ int main(int argc, char* argv[])
     
     // Run the game loop
     game.run();
-    TTF_Quit();
-    SDL_Quit();
+    game.cleanup();
+    if (!traceFile.empty() && Trace::writeJson(traceFile)) {
+        LOG_INFO("Trace written to " << traceFile);
+    }
+    Logger::instance().shutdown();
     
     return 0;
     }
\ No newline at end of file
@@ -0,0 +1,155 @@
+#include "AsciiWord.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define ASCII_WORD_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        #define ASCII_WORD_TARGET(arch)
+    #else
+        #define ASCII_WORD_TARGET(arch) __attribute__((target(arch)))
+    #endif
+#endif
+
+typedef size_t (*NormalizeKernel)(char* data, size_t length);
+
+static size_t normalizeScalar(char* data, size_t length) {
+    size_t firstInvalid = length;
+    for (size_t i = 0; i < length; ++i) {
+        unsigned char ch = static_cast<unsigned char>(data[i]);
+        unsigned char isLower = static_cast<unsigned char>(ch - 'a') < 26;
+        ch = static_cast<unsigned char>(ch - (isLower << 5));
+        data[i] = static_cast<char>(ch);
+        if (static_cast<unsigned char>(ch - 'A') >= 26 && firstInvalid == length) {
+            firstInvalid = i;
+        }
+    }
+    return firstInvalid;
+}
+
+#ifdef ASCII_WORD_X86
+
+static inline unsigned countTrailingZeros(unsigned mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+// Letters are range-checked by biasing them into the bottom of the signed byte
+// range: (ch + 0x80 - 'a') < (-128 + 26) holds exactly for 'a'..'z'.
+ASCII_WORD_TARGET("sse2")
+static size_t normalizeSSE2(char* data, size_t length) {
+    const __m128i lowerBias = _mm_set1_epi8(static_cast<char>(0x80 - 'a'));
+    const __m128i upperBias = _mm_set1_epi8(static_cast<char>(0x80 - 'A'));
+    const __m128i limit = _mm_set1_epi8(static_cast<char>(0x80 + 26));
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+
+    size_t i = 0;
+    size_t firstInvalid = length;
+    for (; i + 16 <= length; i += 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i isLower = _mm_cmplt_epi8(_mm_add_epi8(bytes, lowerBias), limit);
+        bytes = _mm_sub_epi8(bytes, _mm_and_si128(isLower, caseBit));
+        __m128i isAlpha = _mm_cmplt_epi8(_mm_add_epi8(bytes, upperBias), limit);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), bytes);
+
+        unsigned invalid = ~static_cast<unsigned>(_mm_movemask_epi8(isAlpha)) & 0xFFFFu;
+        if (invalid && firstInvalid == length) {
+            firstInvalid = i + countTrailingZeros(invalid);
+        }
+    }
+
+    size_t tailInvalid = normalizeScalar(data + i, length - i);
+    if (firstInvalid == length && tailInvalid != length - i) {
+        firstInvalid = i + tailInvalid;
+    }
+    return firstInvalid;
+}
+
+ASCII_WORD_TARGET("avx2")
+static size_t normalizeAVX2(char* data, size_t length) {
+    const __m256i lowerBias = _mm256_set1_epi8(static_cast<char>(0x80 - 'a'));
+    const __m256i upperBias = _mm256_set1_epi8(static_cast<char>(0x80 - 'A'));
+    const __m256i limit = _mm256_set1_epi8(static_cast<char>(0x80 + 26));
+    const __m256i caseBit = _mm256_set1_epi8(0x20);
+
+    size_t i = 0;
+    size_t firstInvalid = length;
+    for (; i + 32 <= length; i += 32) {
+        __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i isLower = _mm256_cmpgt_epi8(limit, _mm256_add_epi8(bytes, lowerBias));
+        bytes = _mm256_sub_epi8(bytes, _mm256_and_si256(isLower, caseBit));
+        __m256i isAlpha = _mm256_cmpgt_epi8(limit, _mm256_add_epi8(bytes, upperBias));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), bytes);
+
+        unsigned invalid = ~static_cast<unsigned>(_mm256_movemask_epi8(isAlpha));
+        if (invalid && firstInvalid == length) {
+            firstInvalid = i + countTrailingZeros(invalid);
+        }
+    }
+
+    // Words are short, so the remainder usually fits the 16-byte kernel
+    size_t tailInvalid = normalizeSSE2(data + i, length - i);
+    if (firstInvalid == length && tailInvalid != length - i) {
+        firstInvalid = i + tailInvalid;
+    }
+    return firstInvalid;
+}
+
+static bool cpuHasAVX2() {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+    __cpuid(info, 1);
+    bool osSavesYmm = (info[2] & (1 << 27)) && ((_xgetbv(0) & 0x6) == 0x6);
+    __cpuidex(info, 7, 0);
+    return osSavesYmm && (info[1] & (1 << 5));
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+static bool cpuHasSSE2() {
+#if defined(_MSC_VER) || defined(__x86_64__)
+    return true;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+#endif
+}
+
+#endif // ASCII_WORD_X86
+
+struct KernelChoice {
+    NormalizeKernel kernel;
+    const char* name;
+};
+
+static const KernelChoice& selectKernel() {
+    static const KernelChoice choice = []() -> KernelChoice {
+#ifdef ASCII_WORD_X86
+        if (cpuHasAVX2()) return {normalizeAVX2, "avx2"};
+        if (cpuHasSSE2()) return {normalizeSSE2, "sse2"};
+#endif
+        return {normalizeScalar, "scalar"};
+    }();
+    return choice;
+}
+
+size_t AsciiWord::normalize(char* data, size_t length) {
+    return selectKernel().kernel(data, length);
+}
+
+bool AsciiWord::normalizeWord(std::string& word) {
+    return normalize(&word[0], word.size()) == word.size();
+}
+
+const char* AsciiWord::getKernelName() {
+    return selectKernel().name;
+}
\ No newline at end of file
@@ -0,0 +1,17 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+// Uppercasing and letter validation for lexicon input. The vector kernels
+// (SSE2 / AVX2) are picked once at runtime from the CPU's feature flags.
+class AsciiWord {
+public:
+    // Uppercases `length` bytes in place and returns the index of the first
+    // byte that is not an ASCII letter, or `length` if every byte is one.
+    static size_t normalize(char* data, size_t length);
+
+    // Returns true when the whole word is made of ASCII letters.
+    static bool normalizeWord(std::string& word);
+
+    static const char* getKernelName();
+};
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include "BloomFilter.hpp"
+#include <algorithm>
+#include <cmath>
+
+BloomFilter::BloomFilter() : blockCount(0), hashCount(0) {}
+
+void BloomFilter::reset(size_t expectedItems, double falsePositiveRate) {
+    falsePositiveRate = std::min(0.5, std::max(1e-6, falsePositiveRate));
+    expectedItems = std::max<size_t>(1, expectedItems);
+
+    // Classic sizing, plus a little slack for the uneven load of blocked filters
+    const double ln2 = std::log(2.0);
+    double bitsPerItem = -std::log(falsePositiveRate) / (ln2 * ln2) * 1.1;
+    size_t totalBits = static_cast<size_t>(std::ceil(bitsPerItem * expectedItems));
+
+    blockCount = std::max<size_t>(1, (totalBits + BITS_PER_BLOCK - 1) / BITS_PER_BLOCK);
+    hashCount = std::min(16, std::max(1, static_cast<int>(std::round(bitsPerItem * ln2))));
+    bits.assign(blockCount * WORDS_PER_BLOCK, 0);
+}
+
+uint64_t BloomFilter::hashKey(const char* data, size_t length) {
+    // FNV-1a followed by a murmur3 finaliser to spread short keys across all 64 bits
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+size_t BloomFilter::blockOffset(uint64_t hash) const {
+    size_t block = static_cast<size_t>(((hash >> 32) * static_cast<uint64_t>(blockCount)) >> 32);
+    return block * WORDS_PER_BLOCK;
+}
+
+void BloomFilter::insert(const std::string& key) {
+    if (bits.empty()) return;
+
+    uint64_t hash = hashKey(key.data(), key.size());
+    uint64_t* block = bits.data() + blockOffset(hash);
+    uint32_t probe = static_cast<uint32_t>(hash);
+    uint32_t step = static_cast<uint32_t>(hash >> 17) | 1;
+
+    for (int i = 0; i < hashCount; ++i) {
+        uint32_t bit = probe % BITS_PER_BLOCK;
+        block[bit >> 6] |= 1ULL << (bit & 63);
+        probe += step;
+    }
+}
+
+bool BloomFilter::mightContain(const std::string& key) const {
+    if (bits.empty()) return true;
+
+    uint64_t hash = hashKey(key.data(), key.size());
+    const uint64_t* block = bits.data() + blockOffset(hash);
+    uint32_t probe = static_cast<uint32_t>(hash);
+    uint32_t step = static_cast<uint32_t>(hash >> 17) | 1;
+
+    for (int i = 0; i < hashCount; ++i) {
+        uint32_t bit = probe % BITS_PER_BLOCK;
+        if (!(block[bit >> 6] & (1ULL << (bit & 63)))) {
+            return false;
+        }
+        probe += step;
+    }
+    return true;
+}
+
+void BloomFilter::clear() {
+    bits.clear();
+    bits.shrink_to_fit();
+    blockCount = 0;
+    hashCount = 0;
+}
+
+bool BloomFilter::isEmpty() const {
+    return bits.empty();
+}
+
+size_t BloomFilter::getSizeBytes() const {
+    return bits.size() * sizeof(uint64_t);
+}
+
+int BloomFilter::getHashCount() const {
+    return hashCount;
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Cache-line blocked Bloom filter: every key maps to one 512-bit block, so a
+// lookup touches a single cache line no matter how many probe bits are used.
+class BloomFilter {
+private:
+    static const size_t WORDS_PER_BLOCK = 8;
+    static const uint32_t BITS_PER_BLOCK = 512;
+
+    std::vector<uint64_t> bits;
+    size_t blockCount;
+    int hashCount;
+
+    static uint64_t hashKey(const char* data, size_t length);
+    size_t blockOffset(uint64_t hash) const;
+
+public:
+    BloomFilter();
+
+    void reset(size_t expectedItems, double falsePositiveRate);
+    void insert(const std::string& key);
+    bool mightContain(const std::string& key) const;
+    void clear();
+
+    bool isEmpty() const;
+    size_t getSizeBytes() const;
+    int getHashCount() const;
+};
\ No newline at end of file
@@ -17,6 +17,33 @@ Board::~Board() {
     }
 }
 
+Board::Board(const Board& other) : Board() {
+    *this = other;
+}
+
+Board& Board::operator=(const Board& other) {
+    if (this == &other) {
+        return *this;
+    }
+
+    // Boards are copied on every game update, so reuse the tiles already allocated
+    for (int i = 0; i < BOARD_SIZE; ++i) {
+        for (int j = 0; j < BOARD_SIZE; ++j) {
+            specialSquares[i][j] = other.specialSquares[i][j];
+            const Tile* source = other.tiles[i][j];
+            if (!source) {
+                delete tiles[i][j];
+                tiles[i][j] = nullptr;
+            } else if (tiles[i][j]) {
+                *tiles[i][j] = *source;
+            } else {
+                tiles[i][j] = new Tile(*source);
+            }
+        }
+    }
+    return *this;
+}
+
 bool Board::placeTile(int row, int col, const Tile& tile) {
     if (row < 0 || row >= BOARD_SIZE || col < 0 || col >= BOARD_SIZE) {
         return false;
@@ -13,6 +13,15 @@ enum class SpecialSquare {
     CENTER
 };
 
+// process cross word
+struct WordInfo {
+    std::string word;
+    int startRow, startCol;
+    bool isHorizontal;
+    std::vector<std::pair<int, int>> positions;
+    std::vector<std::pair<int, int>> newTilePositions;
+};
+
 class Board {
 private:
     static const int BOARD_SIZE = 15;
@@ -39,6 +48,8 @@ private:
 public:
     Board();
     ~Board();
+    Board(const Board& other);
+    Board& operator=(const Board& other);
     
     bool placeTile(int row, int col, const Tile& tile);
     bool removeTile(int row, int col);
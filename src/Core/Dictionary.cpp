@@ -1,79 +1,346 @@
 #include "Dictionary.hpp"
+#include "AsciiWord.hpp"
+#include "Logger.hpp"
+#include "Trace.hpp"
 #include <fstream>
-#include <iostream>
 #include <algorithm>
 #include <cctype>
+#include <cstring>
+#include <chrono>
+#include <thread>
 
 using namespace std;
 
-Dictionary::Dictionary() {}
+// Chunks smaller than this are not worth a thread of their own
+static const size_t MIN_CHUNK_BYTES = 64 * 1024;
+
+static uint64_t mixWordHash(uint64_t value) {
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDULL;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ULL;
+    return value ^ (value >> 33);
+}
+
+static void parseChunk(const char* begin, const char* end, vector<string>& out) {
+    TRACE_SCOPE("Dictionary::parseChunk");
+    string word;
+    const char* lineStart = begin;
+
+    while (lineStart < end) {
+        const char* lineEnd = static_cast<const char*>(memchr(lineStart, '\n', end - lineStart));
+        if (!lineEnd) lineEnd = end;
+
+        const char* wordStart = lineStart;
+        while (wordStart < lineEnd && isspace(static_cast<unsigned char>(*wordStart))) {
+            ++wordStart;
+        }
+        const char* wordEnd = lineEnd;
+        if (wordEnd > wordStart && *(wordEnd - 1) == '\r') {
+            --wordEnd;
+        }
+
+        if (wordEnd > wordStart) {
+            word.assign(wordStart, wordEnd);
+            if (AsciiWord::normalizeWord(word)) {
+                out.push_back(word);
+            }
+        }
+
+        lineStart = lineEnd + 1;
+    }
+}
+
+Dictionary::Dictionary()
+    : bloomEnabled(false), bloomFalsePositiveRate(0.01), lexiconId(0),
+      lookupCount(0), hitCount(0), bloomRejectCount(0), falsePositiveCount(0) {}
 Dictionary::~Dictionary() {words.clear();}
 
-bool Dictionary::loadFromFile(const std::string& filename) {
-    ifstream file(filename);
+bool Dictionary::readFileContents(const std::string& filename, std::string& contents) {
+    TRACE_SCOPE("Dictionary::readFileContents");
+    ifstream file(filename, ios::binary | ios::ate);
     if (!file.is_open()) {
-        std::cerr << "Error opening dictionary file: " << filename << std::endl;
+        LOG_ERROR("Error opening dictionary file: " << filename);
         return false;
     }
 
-    string word;
-    int wordCount = 0;
+    streamsize size = file.tellg();
+    file.seekg(0, ios::beg);
+    contents.resize(static_cast<size_t>(size));
+    if (size > 0 && !file.read(&contents[0], size)) {
+        LOG_ERROR("Error reading dictionary file: " << filename);
+        return false;
+    }
+    return true;
+}
 
-    while (getline(file, word)) {
-        word.erase(word.begin(), find_if(word.begin(), word.end(), [](unsigned char ch) {
-            return !isspace(ch);
-        }));
+void Dictionary::parseWordList(const std::string& contents, size_t maxChunks,
+                               std::vector<std::vector<std::string>>& chunkWords) {
+    const size_t size = contents.size();
+    size_t chunkCount = std::max<size_t>(1, std::min(maxChunks, size / MIN_CHUNK_BYTES));
 
-        if (!word.empty()) {
-            transform(word.begin(), word.end(), word.begin(), ::toupper);
+    // Move every boundary forward to the next newline so no word is split
+    vector<size_t> bounds = {0};
+    for (size_t i = 1; i < chunkCount; ++i) {
+        size_t pos = std::max(bounds.back(), size * i / chunkCount);
+        size_t newline = contents.find('\n', pos);
+        if (newline == string::npos) break;
+        bounds.push_back(newline + 1);
+    }
+    bounds.push_back(size);
 
-            if (all_of(word.begin(), word.end(), ::isalpha)) {
-                words.insert(word);
-                ++wordCount;
-            }
+    const size_t firstChunk = chunkWords.size();
+    chunkWords.resize(firstChunk + bounds.size() - 1);
+
+    vector<thread> workers;
+    for (size_t i = 0; i + 1 < bounds.size(); ++i) {
+        const char* begin = contents.data() + bounds[i];
+        const char* end = contents.data() + bounds[i + 1];
+        vector<string>& out = chunkWords[firstChunk + i];
+        out.reserve((end - begin) / 8);
+
+        if (i + 2 == bounds.size()) {
+            parseChunk(begin, end, out);
+        } else {
+            workers.emplace_back(parseChunk, begin, end, std::ref(out));
+        }
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+size_t Dictionary::mergeWords(std::vector<std::vector<std::string>>& chunkWords) {
+    TRACE_SCOPE("Dictionary::mergeWords");
+    size_t total = 0;
+    for (const auto& chunk : chunkWords) {
+        total += chunk.size();
+    }
+    words.reserve(words.size() + total);
+
+    for (auto& chunk : chunkWords) {
+        for (auto& word : chunk) {
+            words.insert(std::move(word));
+        }
+        chunk.clear();
+        chunk.shrink_to_fit();
+    }
+    return total;
+}
+
+bool Dictionary::loadFromFile(const std::string& filename) {
+    return loadFromFiles({filename});
+}
+
+bool Dictionary::loadFromFiles(const std::vector<std::string>& filenames) {
+    TRACE_SCOPE("Dictionary::loadFromFiles");
+    auto startTime = chrono::steady_clock::now();
+
+    const size_t hardwareThreads = std::max(1u, thread::hardware_concurrency());
+    const size_t chunksPerFile = std::max<size_t>(1, hardwareThreads / std::max<size_t>(1, filenames.size()));
+
+    // Every file is read and parsed on its own thread; the hash set is only touched here
+    vector<vector<vector<string>>> fileWords(filenames.size());
+    vector<char> fileLoaded(filenames.size(), 0);
+    vector<thread> loaders;
+
+    auto loadOne = [&](size_t index) {
+        string contents;
+        if (readFileContents(filenames[index], contents)) {
+            parseWordList(contents, chunksPerFile, fileWords[index]);
+            fileLoaded[index] = 1;
+        }
+    };
+
+    for (size_t i = 1; i < filenames.size(); ++i) {
+        loaders.emplace_back(loadOne, i);
+    }
+    if (!filenames.empty()) {
+        loadOne(0);
+    }
+    for (auto& loader : loaders) {
+        loader.join();
+    }
+
+    bool allLoaded = true;
+    size_t wordCount = 0;
+    for (size_t i = 0; i < filenames.size(); ++i) {
+        allLoaded = allLoaded && fileLoaded[i];
+        wordCount += mergeWords(fileWords[i]);
+    }
+
+    if (!lexicon.isEmpty()) {
+        lexicon.clear();
+    }
+    if (bloomEnabled) {
+        rebuildBloomFilter();
+    }
+
+    {
+        TRACE_SCOPE("LexiconTrie::build");
+        trie.build(vector<string_view>(words.begin(), words.end()));
+    }
+
+    // Summed per-word hashes, so the id ignores file order and duplicates
+    lexiconId = 0;
+    for (const auto& word : words) {
+        uint64_t hash = 14695981039346656037ULL;
+        for (char c : word) {
+            hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
         }
+        lexiconId += mixWordHash(hash);
     }
+    lexiconId = mixWordHash(lexiconId ^ words.size());
 
-    file.close();
-    cout << "Loaded " << wordCount << " words from dictionary.\n";
-    return !words.empty();
+    auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - startTime);
+    LOG_INFO("Loaded " << wordCount << " words from " << filenames.size()
+             << " dictionary file(s) in " << elapsed.count() << " ms (" << words.size() << " unique).");
+
+    return allLoaded && !words.empty();
 }
 
 bool Dictionary::isValidWord(const string& word) const {
     if (word.empty()) return false;
 
+    lookupCount.fetch_add(1, memory_order_relaxed);
+
     string upperWord = word;
-    transform(upperWord.begin(), upperWord.end(), upperWord.begin(), ::toupper);
+    if (!AsciiWord::normalizeWord(upperWord)) return false;
+
+    if (!lexicon.isEmpty()) {
+        if (!lexicon.contains(upperWord)) return false;
+        hitCount.fetch_add(1, memory_order_relaxed);
+        return true;
+    }
+
+    const bool filtered = bloomEnabled && !bloomFilter.isEmpty();
+    if (filtered && !bloomFilter.mightContain(upperWord)) {
+        bloomRejectCount.fetch_add(1, memory_order_relaxed);
+        return false;
+    }
 
-    return words.find(upperWord) != words.end();
+    if (words.find(upperWord) == words.end()) {
+        if (filtered) {
+            falsePositiveCount.fetch_add(1, memory_order_relaxed);
+        }
+        return false;
+    }
+
+    hitCount.fetch_add(1, memory_order_relaxed);
+    return true;
 }
 
 vector<string> Dictionary::getSuggestions(const string& partial) const {
     vector<string> suggestions;
     string upperPartial = partial;
-    transform(upperPartial.begin(), upperPartial.end(), upperPartial.begin(), ::toupper);
+    if (!AsciiWord::normalizeWord(upperPartial)) return suggestions;
 
-    for (const auto& word : words) {
-        if (word.length() >= upperPartial.length() && 
-            word.substr(0, upperPartial.length()) == upperPartial) {
-            suggestions.push_back(word);
-            
-            if (suggestions.size() >= 50) {
-                break;
-            }
+    // Shortest completions first, alphabetical within a length
+    trie.complete(upperPartial, suggestions, 50);
+    return suggestions;
+}
+
+size_t Dictionary::matchPattern(const WordPattern& pattern, std::vector<std::string>& results,
+                                size_t maxResults) const {
+    results.clear();
+    return trie.match(pattern, results, maxResults);
+}
+
+const LexiconTrie& Dictionary::getTrie() const {
+    return trie;
+}
+
+size_t Dictionary::getWordCount() const {
+    return lexicon.isEmpty() ? words.size() : lexicon.getWordCount();
+}
+
+uint64_t Dictionary::getLexiconId() const {
+    return lexiconId;
+}
+
+bool Dictionary::loadFromLexicon(const std::string& filename) {
+    TRACE_SCOPE("Dictionary::loadFromLexicon");
+    auto startTime = chrono::steady_clock::now();
+    if (!lexicon.loadFromFile(filename)) {
+        return false;
+    }
+
+    // The lexicon answers membership on its own; drop everything else
+    words.clear();
+    words.rehash(0);
+    bloomFilter.clear();
+    trie.clear();
+    lexiconId = lexicon.getTableId();
+
+    auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - startTime);
+    LOG_INFO("Loaded lexicon with " << lexicon.getWordCount() << " words ("
+             << lexicon.getSizeBytes() / 1024 << " KB) in " << elapsed.count() << " ms.");
+    return true;
+}
+
+bool Dictionary::saveLexicon(const std::string& filename) const {
+    vector<string> wordList(words.begin(), words.end());
+    sort(wordList.begin(), wordList.end());
+
+    PerfectHashLexicon table;
+    if (!table.build(wordList)) {
+        return false;
+    }
+    for (const auto& word : wordList) {
+        if (!table.contains(word)) {
+            LOG_ERROR("Perfect hash lost word: " << word);
+            return false;
         }
     }
+    return table.saveToFile(filename);
+}
 
-    sort(suggestions.begin(), suggestions.end(), [](const std::string& a, const std::string& b) {
-                  if (a.length() == b.length()) {
-                      return a < b;
-                  }
-                  return a.length() < b.length();
-              });
+bool Dictionary::isLexiconLoaded() const {
+    return !lexicon.isEmpty();
+}
 
-    return suggestions;
+void Dictionary::enableBloomFilter(double falsePositiveRate) {
+    bloomEnabled = true;
+    bloomFalsePositiveRate = falsePositiveRate;
+    if (!words.empty() && lexicon.isEmpty()) {
+        rebuildBloomFilter();
+    }
 }
 
-size_t Dictionary::getWordCount() const {
-    return words.size();
+void Dictionary::disableBloomFilter() {
+    bloomEnabled = false;
+    bloomFilter.clear();
+}
+
+bool Dictionary::isBloomFilterEnabled() const {
+    return bloomEnabled;
+}
+
+size_t Dictionary::getBloomFilterBytes() const {
+    return bloomFilter.getSizeBytes();
+}
+
+void Dictionary::rebuildBloomFilter() {
+    TRACE_SCOPE("Dictionary::rebuildBloomFilter");
+    bloomFilter.reset(words.size(), bloomFalsePositiveRate);
+    for (const auto& word : words) {
+        bloomFilter.insert(word);
+    }
+}
+
+DictionaryLookupStats Dictionary::getLookupStats() const {
+    DictionaryLookupStats stats;
+    stats.lookups = lookupCount.load(memory_order_relaxed);
+    stats.hits = hitCount.load(memory_order_relaxed);
+    stats.misses = stats.lookups - stats.hits;
+    stats.bloomRejects = bloomRejectCount.load(memory_order_relaxed);
+    stats.falsePositives = falsePositiveCount.load(memory_order_relaxed);
+    return stats;
+}
+
+void Dictionary::resetLookupStats() {
+    lookupCount.store(0, memory_order_relaxed);
+    hitCount.store(0, memory_order_relaxed);
+    bloomRejectCount.store(0, memory_order_relaxed);
+    falsePositiveCount.store(0, memory_order_relaxed);
 }
\ No newline at end of file
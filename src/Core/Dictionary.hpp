@@ -1,19 +1,73 @@
 #pragma once
+#include "BloomFilter.hpp"
+#include "LexiconTrie.hpp"
+#include "PerfectHashLexicon.hpp"
+#include <atomic>
+#include <cstdint>
 #include <string>
 #include <unordered_set>
 #include <vector>
 using namespace std;
 
+struct DictionaryLookupStats {
+    uint64_t lookups;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t bloomRejects;      // misses answered by the filter alone
+    uint64_t falsePositives;    // filter said "maybe" but the word set said no
+};
+
 class Dictionary {
 private:
     std::unordered_set<std::string> words;
+    LexiconTrie trie;     // same words, for prefix and pattern queries
+
+    // Optional negative-lookup filter in front of the word set
+    BloomFilter bloomFilter;
+    bool bloomEnabled;
+    double bloomFalsePositiveRate;
+
+    // Membership-only backend; when loaded it replaces the word set
+    PerfectHashLexicon lexicon;
+
+    // Order-independent hash of the loaded words, stored in game records
+    uint64_t lexiconId;
+
+    mutable std::atomic<uint64_t> lookupCount;
+    mutable std::atomic<uint64_t> hitCount;
+    mutable std::atomic<uint64_t> bloomRejectCount;
+    mutable std::atomic<uint64_t> falsePositiveCount;
+
+    void rebuildBloomFilter();
+
+    static bool readFileContents(const std::string& filename, std::string& contents);
+    static void parseWordList(const std::string& contents, size_t maxChunks,
+                              std::vector<std::vector<std::string>>& chunkWords);
+    size_t mergeWords(std::vector<std::vector<std::string>>& chunkWords);
     
 public:
     Dictionary();
     ~Dictionary();
 
     bool loadFromFile(const std::string& filename);
+    bool loadFromFiles(const std::vector<std::string>& filenames);
+    bool loadFromLexicon(const std::string& filename);
+    bool saveLexicon(const std::string& filename) const;
+    bool isLexiconLoaded() const;
     bool isValidWord(const std::string& word) const;
     vector<std::string> getSuggestions(const std::string& partial) const;
+    size_t matchPattern(const WordPattern& pattern, std::vector<std::string>& results,
+                        size_t maxResults = SIZE_MAX) const;
+    // Empty while a membership-only lexicon is loaded
+    const LexiconTrie& getTrie() const;
     size_t getWordCount() const;
+    uint64_t getLexiconId() const;
+
+    void enableBloomFilter(double falsePositiveRate = 0.01);
+    void disableBloomFilter();
+    bool isBloomFilterEnabled() const;
+    size_t getBloomFilterBytes() const;
+
+    DictionaryLookupStats getLookupStats() const;
+    void resetLookupStats();
 };
\ No newline at end of file
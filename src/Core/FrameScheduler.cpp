@@ -0,0 +1,139 @@
+#include "FrameScheduler.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <iomanip>
+
+FrameScheduler::FrameScheduler()
+    : vsyncEnabled(false), frameIntervalNS(SDL_NS_PER_SECOND / 60), nextFrameNS(0), frameStartNS(0),
+      lastPresentNS(0), clockNS(0), clockAccumulatorNS(0), frameTimeCursor(0), renderTimeCursor(0) {
+}
+
+void FrameScheduler::configure(SDL_Renderer* renderer, int targetRate) {
+    frameIntervalNS = SDL_NS_PER_SECOND / static_cast<Uint64>(std::max(1, targetRate));
+
+    int vsync = 0;
+    vsyncEnabled = renderer && SDL_SetRenderVSync(renderer, 1) &&
+                   SDL_GetRenderVSync(renderer, &vsync) && vsync == 1;
+    if (vsyncEnabled) {
+        LOG_INFO("Frame pacing: vsync");
+    } else {
+        LOG_INFO("Frame pacing: " << std::max(1, targetRate) << " Hz timer (vsync unavailable)");
+    }
+    reset();
+}
+
+void FrameScheduler::reset() {
+    const Uint64 now = SDL_GetTicksNS();
+    nextFrameNS = now;
+    frameStartNS = now;
+    lastPresentNS = 0;
+    clockNS = now;
+    clockAccumulatorNS = 0;
+    frameTimes.clear();
+    renderTimes.clear();
+    frameTimeCursor = 0;
+    renderTimeCursor = 0;
+}
+
+bool FrameScheduler::isVSyncEnabled() const {
+    return vsyncEnabled;
+}
+
+bool FrameScheduler::isFrameDue(Uint64 nowNS) const {
+    return vsyncEnabled || nowNS >= nextFrameNS;
+}
+
+Uint64 FrameScheduler::getTimeUntilNextFrameNS(Uint64 nowNS) const {
+    if (isFrameDue(nowNS)) return 0;
+    return nextFrameNS - nowNS;
+}
+
+void FrameScheduler::waitForNextFrame() {
+    const Uint64 remaining = getTimeUntilNextFrameNS(SDL_GetTicksNS());
+    if (remaining == 0) return;
+
+    // Sleep the whole milliseconds in the event queue so input still wakes
+    // the loop, then finish the sub-millisecond part precisely
+    const Sint32 timeoutMS = static_cast<Sint32>(remaining / SDL_NS_PER_MS);
+    if (timeoutMS > 0 && SDL_WaitEventTimeout(nullptr, timeoutMS)) return;
+    if (SDL_HasEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST)) return;
+
+    const Uint64 left = getTimeUntilNextFrameNS(SDL_GetTicksNS());
+    if (left > 0) SDL_DelayPrecise(left);
+}
+
+double FrameScheduler::advanceClock(Uint64 nowNS) {
+    // A long idle stretch only moves animations forward by MAX_CATCH_UP_NS,
+    // so they resume where they were instead of jumping
+    clockAccumulatorNS += std::min(nowNS - clockNS, MAX_CATCH_UP_NS);
+    clockNS = nowNS;
+
+    const Uint64 ticks = clockAccumulatorNS / ANIMATION_TICK_NS;
+    clockAccumulatorNS -= ticks * ANIMATION_TICK_NS;
+    return static_cast<double>(ticks * ANIMATION_TICK_NS) / SDL_NS_PER_SECOND;
+}
+
+void FrameScheduler::beginFrame(Uint64 nowNS) {
+    frameStartNS = nowNS;
+
+    // Keep the cadence while frames arrive on time, restart it after a gap
+    if (nowNS >= nextFrameNS && nowNS - nextFrameNS < frameIntervalNS) {
+        nextFrameNS += frameIntervalNS;
+    } else {
+        nextFrameNS = nowNS + frameIntervalNS;
+    }
+}
+
+void FrameScheduler::endFrame(Uint64 nowNS) {
+    record(renderTimes, renderTimeCursor, static_cast<float>(nowNS - frameStartNS) / SDL_NS_PER_MS);
+
+    // Frames drawn on demand after an idle gap say nothing about pacing
+    if (lastPresentNS != 0 && nowNS - lastPresentNS < 2 * frameIntervalNS) {
+        record(frameTimes, frameTimeCursor, static_cast<float>(nowNS - lastPresentNS) / SDL_NS_PER_MS);
+    }
+    lastPresentNS = nowNS;
+}
+
+void FrameScheduler::record(std::vector<float>& history, size_t& cursor, float value) {
+    if (history.size() < HISTORY_SIZE) {
+        history.push_back(value);
+    } else {
+        history[cursor] = value;
+    }
+    cursor = (cursor + 1) % HISTORY_SIZE;
+}
+
+FrameStats FrameScheduler::computeStats(const std::vector<float>& history) {
+    FrameStats stats = {history.size(), 0.0, 0.0, 0.0, 0.0};
+    if (history.empty()) return stats;
+
+    std::vector<float> sorted(history);
+    std::sort(sorted.begin(), sorted.end());
+    auto percentile = [&sorted](double p) {
+        return static_cast<double>(sorted[static_cast<size_t>(p * (sorted.size() - 1) + 0.5)]);
+    };
+    stats.p50Ms = percentile(0.50);
+    stats.p95Ms = percentile(0.95);
+    stats.p99Ms = percentile(0.99);
+    stats.worstMs = sorted.back();
+    return stats;
+}
+
+FrameStats FrameScheduler::getFrameTimeStats() const {
+    return computeStats(frameTimes);
+}
+
+FrameStats FrameScheduler::getRenderTimeStats() const {
+    return computeStats(renderTimes);
+}
+
+void FrameScheduler::printStats() const {
+    const FrameStats frame = getFrameTimeStats();
+    const FrameStats render = getRenderTimeStats();
+    LOG_INFO(std::fixed << std::setprecision(2)
+             << "Frame time (ms, last " << frame.samples << "): p50 " << frame.p50Ms
+             << "  p95 " << frame.p95Ms << "  p99 " << frame.p99Ms << "  worst " << frame.worstMs);
+    LOG_INFO(std::fixed << std::setprecision(2)
+             << "Render time (ms, last " << render.samples << "): p50 " << render.p50Ms
+             << "  p95 " << render.p95Ms << "  p99 " << render.p99Ms << "  worst " << render.worstMs);
+}
\ No newline at end of file
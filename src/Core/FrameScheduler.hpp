@@ -0,0 +1,62 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <cstddef>
+#include <vector>
+
+struct FrameStats {
+    size_t samples;
+    double p50Ms;
+    double p95Ms;
+    double p99Ms;
+    double worstMs;
+};
+
+// Decides when the main loop may present the next frame. With vsync the
+// present call itself paces the loop; without it the scheduler sleeps only
+// what is left of the frame budget. Animation time advances in fixed ticks
+// so it does not depend on how long a frame took to draw.
+class FrameScheduler {
+private:
+    static const size_t HISTORY_SIZE = 512;
+    static const Uint64 ANIMATION_TICK_NS = SDL_NS_PER_SECOND / 120;
+    static const Uint64 MAX_CATCH_UP_NS = SDL_NS_PER_SECOND / 4;
+
+    bool vsyncEnabled;
+    Uint64 frameIntervalNS;
+    Uint64 nextFrameNS;
+    Uint64 frameStartNS;
+    Uint64 lastPresentNS;
+    Uint64 clockNS;
+    Uint64 clockAccumulatorNS;
+
+    std::vector<float> frameTimes;    // present to present, back-to-back frames only
+    std::vector<float> renderTimes;   // start of render to end of present
+    size_t frameTimeCursor;
+    size_t renderTimeCursor;
+
+    static void record(std::vector<float>& history, size_t& cursor, float value);
+    static FrameStats computeStats(const std::vector<float>& history);
+
+public:
+    FrameScheduler();
+
+    // Tries to turn on vsync; falls back to sleeping towards targetRate.
+    void configure(SDL_Renderer* renderer, int targetRate);
+    void reset();
+
+    bool isVSyncEnabled() const;
+    bool isFrameDue(Uint64 nowNS) const;
+    Uint64 getTimeUntilNextFrameNS(Uint64 nowNS) const;
+
+    // Sleeps out the rest of the budget; returns early when an event arrives.
+    void waitForNextFrame();
+
+    // Returns the animation time to advance, in whole ticks.
+    double advanceClock(Uint64 nowNS);
+    void beginFrame(Uint64 nowNS);
+    void endFrame(Uint64 nowNS);
+
+    FrameStats getFrameTimeStats() const;
+    FrameStats getRenderTimeStats() const;
+    void printStats() const;
+};
\ No newline at end of file
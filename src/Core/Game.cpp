@@ -1,14 +1,54 @@
 #include "Game.hpp"
 #include "../UI/GameRenderer.hpp"
-#include <iostream>
+#include "Logger.hpp"
+#include "Rules.hpp"
+#include "Trace.hpp"
 #include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <random>
-#include <set>
+#include <sstream>
 
-Game::Game() : gameState(GameState::MENU), gameMode(GameMode::HUMAN_VS_HUMAN),
+// "[A](1) [>B<](3) ..." with the selected tile marked
+static std::string formatRack(const std::vector<Tile>& rack, int selected, bool withPoints) {
+    std::ostringstream out;
+    for (size_t i = 0; i < rack.size(); i++) {
+        const bool marked = static_cast<int>(i) == selected;
+        out << (marked ? "[>" : "[") << rack[i].getLetter() << (marked ? "<]" : "]");
+        if (withPoints) out << "(" << rack[i].getPoints() << ")";
+        out << " ";
+    }
+    return out.str();
+}
+
+Game::Game() : gameSeed(0), fixedSeed(false), rngState(0), autosavedMoves(SIZE_MAX), gameState(GameState::MENU), gameMode(GameMode::HUMAN_VS_HUMAN),
                currentPlayerIndex(0), gameOver(false), consecutivePasses(0), consecutiveFailures(0),
                window(nullptr), renderer(nullptr), isRunning(false),
-               selectedTileIndex(0), mouseX(0), mouseY(0), mouseOnBoard(false) {
+               selectedTileIndex(0), mouseX(0), mouseY(0), mouseOnBoard(false),
+               needsRedraw(true), hoverRow(-1), hoverCol(-1), lastActivityTime(0),
+               perfHudVisible(false), lastPerfHudRefresh(0), lastLookupCount(0), lookupsPerSecond(0.0),
+               stopRequested(false), snapshotEventType(0), wakePending(false), tutorialVisible(false),
+               scoreVersion(0), drawnScoreVersion(0), startupBegin(0), phaseBegin(0), startupReported(false) {
+}
+
+GameSnapshot::GameSnapshot() : gameState(GameState::MENU), gameMode(GameMode::HUMAN_VS_HUMAN),
+                               currentPlayerIndex(0), selectedTileIndex(0), tileBagSize(0),
+                               tutorialVisible(false), scoreVersion(0) {
+}
+
+const Player& GameSnapshot::getCurrentPlayer() const {
+    return currentPlayerIndex == 0 ? player1 : player2;
+}
+
+std::vector<TilePlacement> GameSnapshot::getCurrentWord() const {
+    std::vector<TilePlacement> placements;
+    for (const auto& pos : currentWordPositions) {
+        if (const Tile* tile = board.getTile(pos.first, pos.second)) {
+            placements.push_back({pos.first, pos.second, tile});
+        }
+    }
+    return placements;
 }
 
 Game::~Game() {
@@ -16,45 +56,60 @@ Game::~Game() {
 }
 
 bool Game::initialize() {
+    startupBegin = phaseBegin = Trace::now();
+
     // Initialize SDL
-    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
-        std::cerr << "SDL could not initialize! SDL Error: " << SDL_GetError() << std::endl;
+    if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS)) {
+        LOG_ERROR("SDL could not initialize! SDL Error: " << SDL_GetError());
         return false;
     }
+    markStartupPhase("sdl_init");
     
     // Create window
     window = SDL_CreateWindow("Scrabble Word Game", 
                              WINDOW_WIDTH, WINDOW_HEIGHT, 
                              SDL_WINDOW_RESIZABLE);
     if (!window) {
-        std::cerr << "Window could not be created! SDL Error: " << SDL_GetError() << std::endl;
+        LOG_ERROR("Window could not be created! SDL Error: " << SDL_GetError());
         return false;
     }
+    markStartupPhase("window");
     
     // Create renderer
     renderer = SDL_CreateRenderer(window, nullptr);
     if (!renderer) {
-        std::cerr << "Renderer could not be created! SDL Error: " << SDL_GetError() << std::endl;
+        LOG_ERROR("Renderer could not be created! SDL Error: " << SDL_GetError());
         return false;
     }
+    frameScheduler.configure(renderer, TARGET_FRAME_RATE);
+    markStartupPhase("renderer");
     
+    // Initializes SDL_ttf and loads the fonts
     gameRenderer = std::make_unique<GameRenderer>(renderer, window);
+    markStartupPhase("fonts");
 
-
-    // Load dictionary
-    if (!loadDictionary("src/Constant/word_bank.txt")) {
-        std::cerr << "Warning: Could not load dictionary file" << std::endl;
+    // Wakes the main loop when the simulation thread publishes a snapshot
+    snapshotEventType = SDL_RegisterEvents(1);
+    if (snapshotEventType == 0) {
+        snapshotEventType = SDL_EVENT_USER;
     }
 
-    if (!loadDictionary("src/Constant/enable1.txt")) {
-        std::cerr << "Warning: Could not load dictionary file" << std::endl;
-    }
+    // Both word lists are parsed concurrently, off the main thread, so the
+    // menu is up while they load
+    dictionary.enableBloomFilter(0.01);
+    startDictionaryLoad({"src/Constant/word_bank.txt", "src/Constant/enable1.txt"});
     
     isRunning = true;
     return true;
 }
 
 void Game::cleanup() {
+    stopSimulation();
+    waitForDictionary();
+
+    // The renderer's textures must go before the SDL renderer that owns them
+    gameRenderer.reset();
+
     if (renderer) {
         SDL_DestroyRenderer(renderer);
         renderer = nullptr;
@@ -70,6 +125,35 @@ void Game::cleanup() {
 
 bool Game::setupGame(GameMode mode, const std::string& player1Name, 
                      const std::string& player2Name) {
+    // Start only blocks when the background load is still running
+    waitForDictionary();
+    assignPlayers(mode, player1Name, player2Name);
+    
+    if (!fixedSeed) {
+        gameSeed = std::random_device()();
+    }
+    fixedSeed = false;
+    rngState = gameSeed;
+    record.clear();
+    record.seed = gameSeed;
+    record.lexiconId = dictionary.getLexiconId();
+    record.gameMode = static_cast<uint8_t>(mode);
+    autosavedMoves = SIZE_MAX;
+
+    initializeTileBag();
+    fillPlayerRacks();
+    
+    if (gameState == GameState::MENU) {
+        currentPlayerIndex = 0;
+        gameOver = false;
+        consecutivePasses = 0;
+        consecutiveFailures = 0;
+    }
+    
+    return true;
+}
+
+void Game::assignPlayers(GameMode mode, const std::string& player1Name, const std::string& player2Name) {
     gameMode = mode;
     
     switch (mode) {
@@ -88,43 +172,23 @@ bool Game::setupGame(GameMode mode, const std::string& player1Name,
             player2 = Player(player2Name, PlayerType::AI_HARD);
             break;
     }
-    
-    initializeTileBag();
-    fillPlayerRacks();
-    
-    if (gameState == GameState::MENU) {
-        currentPlayerIndex = 0;
-        gameOver = false;
-        consecutivePasses = 0;
-        consecutiveFailures = 0;
-    }
-    
-    return true;
 }
 
 void Game::selectTileFromRack(int index) {
     const auto& rack = getCurrentPlayer().getRack();
     
-    std::cout << "selectTileFromRack called with index: " << index 
-              << ", rack size: " << rack.size() << std::endl;
+    LOG_DEBUG("selectTileFromRack called with index: " << index << ", rack size: " << rack.size());
     
     if (rack.empty()) {
         selectedTileIndex = 0;
-        std::cout << "No tiles available in rack!" << std::endl;
+        LOG_DEBUG("No tiles available in rack!");
         return;
     }
     
     if (index >= 0 && index < static_cast<int>(rack.size())) {
         selectedTileIndex = index;
 
-        for (size_t i = 0; i < rack.size(); i++) {
-            if (static_cast<int>(i) == selectedTileIndex) {
-                std::cout << "[>" << rack[i].getLetter() << "<] ";
-            } else {
-                std::cout << "[" << rack[i].getLetter() << "] ";
-            }
-        }
-        std::cout << std::endl;
+        LOG_DEBUG(formatRack(rack, selectedTileIndex, false));
     } else {
         if (index < 0) {
             selectedTileIndex = 0;
@@ -156,47 +220,63 @@ void Game::selectPreviousTile() {
 }
 
 bool Game::loadDictionary(const std::string& filename) {
+    waitForDictionary();
     return dictionary.loadFromFile(filename);
 }
 
-void Game::initializeTileBag() {
-    while (!tileBag.empty()) {
-        tileBag.pop();
-    }
-    
-    struct TileInfo { char letter; int count; };
-    
-    std::vector<TileInfo> tileDistribution = {
-        {'A', 9}, {'B', 2}, {'C', 2}, {'D', 4}, {'E', 12}, {'F', 2},
-        {'G', 3}, {'H', 2}, {'I', 9}, {'J', 1}, {'K', 1}, {'L', 4},
-        {'M', 2}, {'N', 6}, {'O', 8}, {'P', 2}, {'Q', 1}, {'R', 6},
-        {'S', 4}, {'T', 6}, {'U', 4}, {'V', 2}, {'W', 2}, {'X', 1},
-        {'Y', 2}, {'Z', 1}, {' ', 2}
-    };
-    
-    for (const auto& tileInfo : tileDistribution) {
-        for (int i = 0; i < tileInfo.count; ++i) {
-            if (tileInfo.letter == ' ') {
-                tileBag.push(Tile());
-            } else {
-                tileBag.push(Tile(tileInfo.letter));
-            }
+bool Game::loadDictionaries(const std::vector<std::string>& filenames) {
+    waitForDictionary();
+    return dictionary.loadFromFiles(filenames);
+}
+
+void Game::startDictionaryLoad(const std::vector<std::string>& filenames) {
+    waitForDictionary();
+    dictionaryLoad = std::async(std::launch::async, [this, filenames, requested = Trace::now()] {
+        Trace::setThreadName("dictionary");
+        const bool loaded = dictionary.loadFromFiles(filenames);
+        if (!loaded) {
+            LOG_WARN("Could not load dictionary file");
         }
+        LOG_INFO("Dictionary ready after " << (Trace::now() - requested) / 1000000 << " ms in the background");
+        return loaded;
+    }).share();
+}
+
+void Game::waitForDictionary() const {
+    if (!dictionaryLoad.valid()) return;
+
+    if (dictionaryLoad.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        TRACE_SCOPE("Game::waitForDictionary");
+        const uint64_t start = Trace::now();
+        LOG_INFO("Waiting for the dictionary to finish loading...");
+        dictionaryLoad.wait();
+        LOG_INFO("Dictionary wait took " << (Trace::now() - start) / 1000000 << " ms");
     }
-    
-    std::vector<Tile> tempTiles;
-    while (!tileBag.empty()) {
-        tempTiles.push_back(tileBag.front());
-        tileBag.pop();
+}
+
+void Game::markStartupPhase(const char* name) {
+    const uint64_t now = Trace::now();
+    startupPhases.push_back({name, now - phaseBegin});
+    if (Trace::isEnabled()) {
+        Trace::record(name, phaseBegin, now);
     }
-    
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::shuffle(tempTiles.begin(), tempTiles.end(), gen);
-    
-    for (const auto& tile : tempTiles) {
-        tileBag.push(tile);
+    phaseBegin = now;
+}
+
+void Game::reportStartup() {
+    markStartupPhase("first_frame");
+    startupReported = true;
+
+    std::ostringstream phases;
+    for (const StartupPhase& phase : startupPhases) {
+        phases << " " << phase.name << " " << phase.nanos / 1000000.0 << " ms,";
     }
+    LOG_INFO("Start-up:" << phases.str() << " menu shown after "
+             << (Trace::now() - startupBegin) / 1000000.0 << " ms");
+}
+
+void Game::initializeTileBag() {
+    Rules::fillBag(tileBag, rngState);
 }
 
 bool Game::drawTilesForPlayer(Player& player, int count) {
@@ -209,6 +289,12 @@ bool Game::drawTilesForPlayer(Player& player, int count) {
     return drawn == count;
 }
 
+void Game::drawUntilFull(Player& player) {
+    while (player.getRackSize() < 7 && !tileBag.empty()) {
+        drawTilesForPlayer(player, 1);
+    }
+}
+
 void Game::fillPlayerRacks() {
     while (player1.getRackSize() < 7 && !tileBag.empty()) {
         drawTilesForPlayer(player1, 1);
@@ -222,18 +308,219 @@ void Game::fillPlayerRacks() {
 }
 
 void Game::run() {
+    lastActivityTime = SDL_GetTicks();
+    frameScheduler.reset();
+    startSimulation();
     while (isRunning) {
+        waitForEvents();
         handleEvents();
-        
-        // Handle AI moves
-        if (gameState == GameState::PLAYING && getCurrentPlayer().isAI()) {
+
+        // Clear first: a snapshot published after this pushes another wake-up
+        wakePending = false;
+        if (snapshots.update()) {
+            applySnapshot(snapshots.read());
+            needsRedraw = true;
+        }
+
+        if (isPerfHudRefreshDue(SDL_GetTicks())) {
+            needsRedraw = true;
+        }
+
+        const Uint64 now = SDL_GetTicksNS();
+        if (needsRedraw || (isAnimating() && frameScheduler.isFrameDue(now))) {
+            gameRenderer->advanceAnimation(frameScheduler.advanceClock(now));
+            frameScheduler.beginFrame(now);
+            render();
+            frameScheduler.endFrame(SDL_GetTicksNS());
+            needsRedraw = false;
+            if (!startupReported) {
+                reportStartup();
+            }
+        }
+    }
+    stopSimulation();
+    frameScheduler.printStats();
+}
+
+void Game::startSimulation() {
+    if (simulationThread.joinable()) return;
+    stopRequested = false;
+    simulationThread = std::thread(&Game::simulationLoop, this);
+}
+
+void Game::stopSimulation() {
+    if (!simulationThread.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(inputMutex);
+        stopRequested = true;
+    }
+    inputReady.notify_one();
+    simulationThread.join();
+}
+
+void Game::simulationLoop() {
+    Trace::setThreadName("simulation");
+    std::vector<InputCommand> pending;
+    publishSnapshot();
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(inputMutex);
+            inputReady.wait(lock, [this] { return stopRequested || !inputQueue.empty() || isAITurn(); });
+            if (stopRequested) break;
+            pending.swap(inputQueue);
+        }
+
+        for (const InputCommand& command : pending) {
+            TRACE_SCOPE("Game::processInput");
+            if (command.type == InputCommand::Type::MOUSE_CLICK) {
+                handleMouseClick(command.x, command.y);
+            } else {
+                handleKeyPress(command.key);
+            }
+        }
+        pending.clear();
+
+        if (isAITurn()) {
+            TRACE_SCOPE("Game::aiTurn");
             // Simple AI: skip turn for now (implement AI logic later)
             skipTurn();
         }
-        
-        render();
-        SDL_Delay(16);
+        autosave();
+        publishSnapshot();
+    }
+}
+
+void Game::postInput(const InputCommand& command) {
+    {
+        std::lock_guard<std::mutex> lock(inputMutex);
+        inputQueue.push_back(command);
+    }
+    inputReady.notify_one();
+}
+
+bool Game::isAITurn() const {
+    return gameState == GameState::PLAYING && getCurrentPlayer().isAI();
+}
+
+void Game::publishSnapshot() {
+    TRACE_SCOPE("Game::publishSnapshot");
+    GameSnapshot& snapshot = snapshots.getWriteBuffer();
+    snapshot.board = board;
+    snapshot.player1 = player1;
+    snapshot.player2 = player2;
+    snapshot.gameState = gameState;
+    snapshot.gameMode = gameMode;
+    snapshot.currentPlayerIndex = currentPlayerIndex;
+    snapshot.selectedTileIndex = selectedTileIndex;
+    snapshot.currentWordPositions = currentWordPositions;
+    snapshot.tileBagSize = tileBag.size();
+    snapshot.tutorialVisible = tutorialVisible;
+    snapshot.scoreVersion = scoreVersion;
+    snapshots.publish();
+
+    // One pending wake-up is enough; the main loop always takes the newest snapshot
+    if (!wakePending.exchange(true)) {
+        SDL_Event event;
+        SDL_zero(event);
+        event.type = snapshotEventType;
+        SDL_PushEvent(&event);
+    }
+}
+
+void Game::applySnapshot(const GameSnapshot& snapshot) {
+    // Score labels are cached as laid-out text; drop the stale ones
+    if (snapshot.scoreVersion != drawnScoreVersion) {
+        gameRenderer->invalidateScoreText();
+        drawnScoreVersion = snapshot.scoreVersion;
+    }
+    GameRenderer::setTutorialVisible(snapshot.tutorialVisible);
+}
+
+void Game::markDirty() {
+    needsRedraw = true;
+    lastActivityTime = SDL_GetTicks();
+}
+
+bool Game::updateHoverCell(int x, int y) {
+    int row = -1, col = -1;
+    if (!gameRenderer->isPointInBoard(x, y, row, col)) {
+        row = -1;
+        col = -1;
+    }
+    mouseOnBoard = row >= 0;
+    if (row == hoverRow && col == hoverCol) {
+        return false;
     }
+    hoverRow = row;
+    hoverCol = col;
+    return true;
+}
+
+bool Game::isAnimating() const {
+    // The menu, pause and game over screens pulse continuously; once nobody
+    // has touched the machine for a while they settle on their last frame
+    switch (snapshots.read().gameState) {
+        case GameState::MENU:
+        case GameState::PAUSED:
+        case GameState::GAME_OVER:
+            return SDL_GetTicks() - lastActivityTime < AMBIENT_ANIMATION_TIMEOUT_MS;
+        default:
+            return false;
+    }
+}
+
+void Game::waitForEvents() {
+    if (needsRedraw) {
+        return;
+    }
+
+    // Passing nullptr leaves the event queued for handleEvents
+    if (isAnimating()) {
+        frameScheduler.waitForNextFrame();
+    } else if (perfHudVisible) {
+        SDL_WaitEventTimeout(nullptr, static_cast<Sint32>(PERF_HUD_REFRESH_MS));
+    } else {
+        SDL_WaitEvent(nullptr);
+    }
+}
+
+void Game::togglePerfHud() {
+    perfHudVisible = !perfHudVisible;
+    lastPerfHudRefresh = SDL_GetTicks();
+    lastLookupCount = dictionary.getLookupStats().lookups;
+    lookupsPerSecond = 0.0;
+}
+
+bool Game::isPerfHudRefreshDue(Uint64 now) const {
+    return perfHudVisible && now - lastPerfHudRefresh >= PERF_HUD_REFRESH_MS;
+}
+
+void Game::renderPerfHud() {
+    const Uint64 now = SDL_GetTicks();
+    if (now - lastPerfHudRefresh >= PERF_HUD_REFRESH_MS) {
+        // The counters restart when the dictionary resets its stats
+        const uint64_t lookups = dictionary.getLookupStats().lookups;
+        const uint64_t delta = lookups >= lastLookupCount ? lookups - lastLookupCount : lookups;
+        lookupsPerSecond = delta * 1000.0 / (now - lastPerfHudRefresh);
+        lastLookupCount = lookups;
+        lastPerfHudRefresh = now;
+    }
+
+    PerfHudStats stats;
+    stats.frameTime = frameScheduler.getFrameTimeStats();
+    stats.renderTime = frameScheduler.getRenderTimeStats();
+    stats.vsync = frameScheduler.isVSyncEnabled();
+    stats.lastFrame = gameRenderer->getLastFrameCounters();
+    stats.moveGeneration = PerfCounters::instance().getMoveGenerationStats();
+    stats.lookupsPerSecond = lookupsPerSecond;
+    stats.residentBytes = PerfCounters::getResidentMemoryBytes();
+    gameRenderer->renderPerfHud(stats);
+}
+
+void Game::awardPoints(Player& player, int points) {
+    player.addScore(points);
+    ++scoreVersion;
 }
 
 bool Game::isGameRunning() const {
@@ -241,7 +528,7 @@ bool Game::isGameRunning() const {
 }
 
 void Game::startNewGame() {
-    std::cout<< "Starting a new game ..." << std::endl;
+    LOG_INFO("Starting a new game ...");
 
     board.clear();
 
@@ -257,25 +544,16 @@ void Game::startNewGame() {
     wordInProgress = false;
 
     setupGame(gameMode, player1.getName(), player2.getName());
+    ++scoreVersion;
 
-    std::cout << "New game started! " << player1.getName() << " goes first." << std::endl;
-    std::cout << "Board cleared, tiles redistributed!" << std::endl;
+    LOG_INFO("New game started! " << player1.getName() << " goes first.");
+    LOG_INFO("Board cleared, tiles redistributed!");
 }
 
 void Game::endGame() {
     gameState = GameState::GAME_OVER;
     gameOver = true;
     
-    std::cout << "\nGAME OVER!" << std::endl;
-    std::cout << "========== FINAL SCORES ==========" << std::endl;
-    
-    std::cout << player1.getName() << ": " << player1.getScore() << " points" << std::endl;
-    std::cout << player2.getName() << ": " << player2.getScore() << " points" << std::endl;
-    
-    std::cout << "\nGame Statistics:" << std::endl;
-    std::cout << player1.getName() << " tiles remaining: " << player1.getRackSize() << std::endl;
-    std::cout << player2.getName() << " tiles remaining: " << player2.getRackSize() << std::endl;
-    
     int player1TileValue = 0;
     int player2TileValue = 0;
     
@@ -286,10 +564,22 @@ void Game::endGame() {
         player2TileValue += tile.getPoints();
     }
     
-    std::cout << player1.getName() << " remaining tile value: " << player1TileValue << " points" << std::endl;
-    std::cout << player2.getName() << " remaining tile value: " << player2TileValue << " points" << std::endl;
+    LOG_INFO("GAME OVER!\n"
+             << "========== FINAL SCORES ==========\n"
+             << player1.getName() << ": " << player1.getScore() << " points\n"
+             << player2.getName() << ": " << player2.getScore() << " points\n"
+             << "\nGame Statistics:\n"
+             << player1.getName() << " tiles remaining: " << player1.getRackSize() << "\n"
+             << player2.getName() << " tiles remaining: " << player2.getRackSize() << "\n"
+             << player1.getName() << " remaining tile value: " << player1TileValue << " points\n"
+             << player2.getName() << " remaining tile value: " << player2TileValue << " points");
     
     determineWinner();
+
+    recordMove(RecordedMoveType::GAME_END, currentPlayerIndex);
+    if (!recordFile.empty() && record.appendToFile(recordFile)) {
+        LOG_INFO("Game record appended to " << recordFile);
+    }
 }
 
 void Game::determineWinner() {
@@ -297,26 +587,28 @@ void Game::determineWinner() {
     int score2 = player2.getScore();
     
     if (score1 > score2) {
-        std::cout << "\n" << player1.getName() << " WINS!" << std::endl;
-        std::cout << "Victory margin: " << (score1 - score2) << " points" << std::endl;
+        LOG_INFO(player1.getName() << " WINS!");
+        LOG_INFO("Victory margin: " << (score1 - score2) << " points");
     } else if (score2 > score1) {
-        std::cout << "\n" << player2.getName() << " WINS!" << std::endl;
-        std::cout << "Victory margin: " << (score2 - score1) << " points" << std::endl;
+        LOG_INFO(player2.getName() << " WINS!");
+        LOG_INFO("Victory margin: " << (score2 - score1) << " points");
     } else {
-        std::cout << "\nSCORES ARE TIED!" << std::endl;
-        std::cout << "Applying tiebreaker rules..." << std::endl;
+        LOG_INFO("SCORES ARE TIED!");
+        LOG_INFO("Applying tiebreaker rules...");
         
         int tiles1 = player1.getRackSize();
         int tiles2 = player2.getRackSize();
         
         if (tiles1 < tiles2) {
-            std::cout << player1.getName() << " wins the tiebreaker!" << std::endl;
-            std::cout << "Reason: Fewer remaining tiles (" << tiles1 << " vs " << tiles2 << ")" << std::endl;
-            player1.addScore(1);
+            LOG_INFO(player1.getName() << " wins the tiebreaker!");
+            LOG_INFO("Reason: Fewer remaining tiles (" << tiles1 << " vs " << tiles2 << ")");
+            recordMove(RecordedMoveType::BONUS, 0, 1);
+            awardPoints(player1, 1);
         } else if (tiles2 < tiles1) {
-            std::cout << player2.getName() << " wins the tiebreaker!" << std::endl;
-            std::cout << "Reason: Fewer remaining tiles (" << tiles2 << " vs " << tiles1 << ")" << std::endl;
-            player2.addScore(1);
+            LOG_INFO(player2.getName() << " wins the tiebreaker!");
+            LOG_INFO("Reason: Fewer remaining tiles (" << tiles2 << " vs " << tiles1 << ")");
+            recordMove(RecordedMoveType::BONUS, 1, 1);
+            awardPoints(player2, 1);
         } else {
             int value1 = 0, value2 = 0;
             for (const auto& tile : player1.getRack()) {
@@ -327,21 +619,23 @@ void Game::determineWinner() {
             }
             
             if (value1 < value2) {
-                std::cout << player1.getName() << " wins the tiebreaker!" << std::endl;
-                std::cout << "Reason: Lower remaining tile value (" << value1 << " vs " << value2 << ")" << std::endl;
-                player1.addScore(1);
+                LOG_INFO(player1.getName() << " wins the tiebreaker!");
+                LOG_INFO("Reason: Lower remaining tile value (" << value1 << " vs " << value2 << ")");
+                recordMove(RecordedMoveType::BONUS, 0, 1);
+                awardPoints(player1, 1);
             } else if (value2 < value1) {
-                std::cout << player2.getName() << " wins the tiebreaker!" << std::endl;
-                std::cout << "Reason: Lower remaining tile value (" << value2 << " vs " << value1 << ")" << std::endl;
-                player2.addScore(1);
+                LOG_INFO(player2.getName() << " wins the tiebreaker!");
+                LOG_INFO("Reason: Lower remaining tile value (" << value2 << " vs " << value1 << ")");
+                recordMove(RecordedMoveType::BONUS, 1, 1);
+                awardPoints(player2, 1);
             } else {
-                std::cout << "TRUE TIE! Both players performed equally well!" << std::endl;
-                std::cout << "Both players are declared winners!" << std::endl;
+                LOG_INFO("TRUE TIE! Both players performed equally well!");
+                LOG_INFO("Both players are declared winners!");
             }
         }
     }
     
-    std::cout << "============================================" << std::endl;
+    LOG_INFO("============================================");
 }
 
 const Player& Game::getCurrentPlayer() const {
@@ -365,7 +659,7 @@ void Game::switchTurn() {
 
     // Shuffle the new current player's rack
     getCurrentPlayer().shuffleRack();
-    std::cout << getCurrentPlayer().getName() << "'s tiles shuffled!" << std::endl;
+    LOG_DEBUG(getCurrentPlayer().getName() << "'s tiles shuffled!");
 }
 
 bool Game::checkGameEnd() {
@@ -412,7 +706,7 @@ bool Game::playWord(const std::string& word, int startRow, int startCol,
     }
     
     int score = calculateWordScore(word, startRow, startCol, direction);
-    getCurrentPlayer().addScore(score);
+    awardPoints(getCurrentPlayer(), score);
     
     auto sortedIndices = tileIndices;
     std::sort(sortedIndices.rbegin(), sortedIndices.rend());
@@ -456,13 +750,14 @@ bool Game::exchangeTiles(const std::vector<int>& tileIndices) {
 void Game::skipTurn() {
     std::string currentPlayerName = getCurrentPlayer().getName();
     
-    std::cout << currentPlayerName << " skipped their turn." << std::endl;
+    LOG_INFO(currentPlayerName << " skipped their turn.");
+    recordMove(RecordedMoveType::PASS, currentPlayerIndex);
     
     consecutivePasses++;
-    std::cout << "Consecutive passes: " << consecutivePasses << "/" << MAX_CONSECUTIVE_PASSES << std::endl;
+    LOG_DEBUG("Consecutive passes: " << consecutivePasses << "/" << MAX_CONSECUTIVE_PASSES);
     
     if (consecutivePasses >= MAX_CONSECUTIVE_PASSES) {
-        std::cout << "🔚 Game ending due to " << MAX_CONSECUTIVE_PASSES << " consecutive passes!" << std::endl;
+        LOG_INFO("🔚 Game ending due to " << MAX_CONSECUTIVE_PASSES << " consecutive passes!");
         endGame();
         return;
     }
@@ -470,27 +765,19 @@ void Game::skipTurn() {
     refreshBothPlayerRacks();
     switchTurn();
     
-    std::cout << "Now it's " << getCurrentPlayer().getName() << "'s turn." << std::endl;
+    LOG_DEBUG("Now it's " << getCurrentPlayer().getName() << "'s turn.");
     
     const auto& rack = getCurrentPlayer().getRack();
-    std::cout << "Your tiles: ";
-    for (size_t i = 0; i < rack.size(); i++) {
-        if (i == selectedTileIndex) {
-            std::cout << "[>" << rack[i].getLetter() << "<](" << rack[i].getPoints() << ") ";
-        } else {
-            std::cout << "[" << rack[i].getLetter() << "](" << rack[i].getPoints() << ") ";
-        }
-    }
-    std::cout << std::endl;
+    LOG_DEBUG("Your tiles: " << formatRack(rack, selectedTileIndex, true));
     
     if (selectedTileIndex >= static_cast<int>(rack.size()) && !rack.empty()) {
         selectedTileIndex = 0;
-        std::cout << "Selected: " << rack[selectedTileIndex].getLetter() 
-                  << " at position 1/" << rack.size() << std::endl;
+        LOG_INFO("Selected: " << rack[selectedTileIndex].getLetter() << " at position 1/" << rack.size());
     }
 }
 
 bool Game::isValidWord(const std::string& word) const {
+    waitForDictionary();
     return dictionary.isValidWord(word);
 }
 
@@ -500,95 +787,98 @@ int Game::calculateWordScore(const std::string& word, int startRow, int startCol
 }
 
 void Game::render() {
+    TRACE_SCOPE("Game::render");
+    // Drawn from the latest snapshot; the simulation thread owns the live state
+    const GameSnapshot& snapshot = snapshots.read();
     gameRenderer->clear();
     
-    switch (gameState) {
+    switch (snapshot.gameState) {
         case GameState::MENU:
             gameRenderer->renderGameStart();
             break;
         case GameState::PLAYING:
-            gameRenderer->renderBoard(board);
-            gameRenderer->renderPlayerRacks(player1, player2, currentPlayerIndex);
-            gameRenderer->renderPlayerInfo(player1, player2, currentPlayerIndex);
-            gameRenderer->renderCurrentWordScore(*this);
+            gameRenderer->renderBoard(snapshot.board);
+            gameRenderer->renderPlayerRacks(snapshot.player1, snapshot.player2, snapshot.currentPlayerIndex);
+            gameRenderer->renderPlayerInfo(snapshot.player1, snapshot.player2, snapshot.currentPlayerIndex);
+            gameRenderer->renderCurrentWordScore(snapshot);
             gameRenderer->renderPauseButton();
-            gameRenderer->renderSelectedTileIndicator(*this);
+            gameRenderer->renderSelectedTileIndicator(snapshot);
             break;
         case GameState::PLACING_TILES:
-            gameRenderer->renderBoard(board);
-            gameRenderer->renderPickedTiles(*this);
-            gameRenderer->renderTilePreview(*this, mouseX, mouseY);
-            gameRenderer->renderPlayerRacks(player1, player2, currentPlayerIndex);
-            gameRenderer->renderPlayerInfo(player1, player2, currentPlayerIndex);
-            gameRenderer->renderCurrentWordScore(*this);
+            gameRenderer->renderBoard(snapshot.board);
+            gameRenderer->renderPickedTiles(snapshot);
+            gameRenderer->renderTilePreview(snapshot, mouseX, mouseY);
+            gameRenderer->renderPlayerRacks(snapshot.player1, snapshot.player2, snapshot.currentPlayerIndex);
+            gameRenderer->renderPlayerInfo(snapshot.player1, snapshot.player2, snapshot.currentPlayerIndex);
+            gameRenderer->renderCurrentWordScore(snapshot);
             gameRenderer->renderPauseButton();
-            gameRenderer->renderSelectedTileIndicator(*this);
+            gameRenderer->renderSelectedTileIndicator(snapshot);
             break;
         case GameState::VALIDATING_WORD:
-            gameRenderer->renderBoard(board);
-            gameRenderer->renderPlayerRacks(player1, player2, currentPlayerIndex);
-            gameRenderer->renderGameState(*this);
+            gameRenderer->renderBoard(snapshot.board);
+            gameRenderer->renderPlayerRacks(snapshot.player1, snapshot.player2, snapshot.currentPlayerIndex);
+            gameRenderer->renderGameState(snapshot);
             break;
         case GameState::GAME_OVER:
-            gameRenderer->renderBoard(board);
-            gameRenderer->renderPlayerInfo(player1, player2, currentPlayerIndex);
-            gameRenderer->renderGameOver(player1, player2);
+            gameRenderer->renderBoard(snapshot.board);
+            gameRenderer->renderPlayerInfo(snapshot.player1, snapshot.player2, snapshot.currentPlayerIndex);
+            gameRenderer->renderGameOver(snapshot.player1, snapshot.player2);
             break;
         case GameState::PAUSED:
-            gameRenderer->renderBoard(board);
-            gameRenderer->renderPlayerRacks(player1, player2, currentPlayerIndex);
-            gameRenderer->renderPlayerInfo(player1, player2, currentPlayerIndex);
+            gameRenderer->renderBoard(snapshot.board);
+            gameRenderer->renderPlayerRacks(snapshot.player1, snapshot.player2, snapshot.currentPlayerIndex);
+            gameRenderer->renderPlayerInfo(snapshot.player1, snapshot.player2, snapshot.currentPlayerIndex);
             gameRenderer->renderPauseMenu();
             break;
     }
-    
+
+    if (perfHudVisible) {
+        renderPerfHud();
+    }
     gameRenderer->present();
 }
 
 void Game::printHelp() const {
-    std::cout << "\n========== SCRABBLE GAME CONTROLS ==========" << std::endl;
-    std::cout << "TILE SELECTION:" << std::endl;
-    std::cout << "  1-7 - Select specific tile from rack" << std::endl;
-    std::cout << "  LEFT/RIGHT ARROWS - Navigate through tiles" << std::endl;
-    std::cout << "\nGAME PLAY:" << std::endl;
-    std::cout << "  MOUSE CLICK - Place selected tile on board" << std::endl;
-    std::cout << "  ENTER - Confirm word placement" << std::endl;
-    std::cout << "  BACKSPACE - Cancel current word" << std::endl;
-    std::cout << "  S - Shuffle current player's rack" << std::endl;
-    std::cout << "  ESC - Pause/Quit game" << std::endl;
-    std::cout << "\n======== TESTING CONTROLS (when not playing) ========" << std::endl;
-    std::cout << "  H - Show this help" << std::endl;
-    std::cout << "  P - Print current game state" << std::endl;
-    std::cout << "  R - Reset/clear the board" << std::endl;
-    std::cout << "  T - Switch turns between players" << std::endl;
-    std::cout << "===============================================" << std::endl;
+    LOG_INFO("========== SCRABBLE GAME CONTROLS ==========\n"
+             "TILE SELECTION:\n"
+             "  1-7 - Select specific tile from rack\n"
+             "  LEFT/RIGHT ARROWS - Navigate through tiles\n"
+             "\nGAME PLAY:\n"
+             "  MOUSE CLICK - Place selected tile on board\n"
+             "  ENTER - Confirm word placement\n"
+             "  BACKSPACE - Cancel current word\n"
+             "  S - Shuffle current player's rack\n"
+             "  ESC - Pause/Quit game\n"
+             "\n======== TESTING CONTROLS (when not playing) ========\n"
+             "  H - Show this help\n"
+             "  P - Print current game state\n"
+             "  R - Reset/clear the board\n"
+             "  T - Switch turns between players\n"
+             "  F3 - Toggle performance overlay\n"
+             "===============================================");
 }
 
 void Game::printGameState() const {
-    std::cout << "\n========== CURRENT GAME STATE ==========" << std::endl;
-    std::cout << "Current Player: " << (getCurrentPlayerIndex() + 1) 
-              << " (" << (currentPlayerIndex == 0 ? player1.getName() : player2.getName()) << ")" << std::endl;
-    std::cout << "Player 1 (" << player1.getName() << "): " << player1.getScore() << " points" << std::endl;
-    std::cout << "Player 2 (" << player2.getName() << "): " << player2.getScore() << " points" << std::endl;
-    std::cout << "Tiles left in bag: " << tileBag.size() << std::endl;
-    std::cout << "Consecutive passes: " << consecutivePasses << std::endl;
-    std::cout << "Consecutive failures: " << consecutiveFailures << std::endl; // Add this line
-    
-    // Show current player's tiles
+    const DictionaryLookupStats lookups = dictionary.getLookupStats();
     const auto& rack = (currentPlayerIndex == 0) ? player1.getRack() : player2.getRack();
-    std::cout << "Current player's tiles: ";
-    if (rack.empty()) {
-        std::cout << "(no tiles)";
-    } else {
-        for (const auto& tile : rack) {
-            std::cout << tile.getLetter() << "(" << tile.getPoints() << ") ";
-        }
-    }
-    std::cout << "\n========================================" << std::endl;
+
+    LOG_INFO("========== CURRENT GAME STATE ==========\n"
+             << "Current Player: " << (getCurrentPlayerIndex() + 1)
+             << " (" << (currentPlayerIndex == 0 ? player1.getName() : player2.getName()) << ")\n"
+             << "Player 1 (" << player1.getName() << "): " << player1.getScore() << " points\n"
+             << "Player 2 (" << player2.getName() << "): " << player2.getScore() << " points\n"
+             << "Tiles left in bag: " << tileBag.size() << "\n"
+             << "Consecutive passes: " << consecutivePasses << "\n"
+             << "Consecutive failures: " << consecutiveFailures << "\n"
+             << "Dictionary lookups: " << lookups.lookups << " (" << lookups.hits << " hits, "
+             << lookups.misses << " misses, " << lookups.bloomRejects << " rejected by filter, "
+             << lookups.falsePositives << " filter false positives)\n"
+             << "Current player's tiles: " << (rack.empty() ? "(no tiles)" : formatRack(rack, -1, true)) << "\n"
+             << "========================================");
 }
 
 void Game::placeTestWord() {
-    std::cout << "\nPlacing test word 'HELLO' on the board..." << std::endl;
+    LOG_INFO("Placing test word 'HELLO' on the board...");
     
     std::vector<Tile> testTiles = {
         Tile('H', 4),
@@ -609,20 +899,20 @@ void Game::placeTestWord() {
     }
     
     if (success) {
-        std::cout << "Successfully placed 'HELLO' on board!" << std::endl;
-        std::cout << "Location: Row " << startRow << ", Columns " << startCol << "-" << (startCol + 4) << std::endl;
+        LOG_INFO("Successfully placed 'HELLO' on board!");
+        LOG_INFO("Location: Row " << startRow << ", Columns " << startCol << "-" << (startCol + 4));
         
         int score = calculateWordScore("HELLO", startRow, startCol, "HORIZONTAL");
-        std::cout << "Word score: " << score << " points" << std::endl;
+        LOG_INFO("Word score: " << score << " points");
     } else {
-        std::cout << "Could not place word (spaces might be occupied)" << std::endl;
+        LOG_INFO("Could not place word (spaces might be occupied)");
     }
 }
 
 void Game::givePlayerTestTiles() {
     Player& current = (currentPlayerIndex == 0) ? player1 : player2;
     
-    std::cout << "\nGiving test tiles to " << current.getName() << "..." << std::endl;
+    LOG_INFO("Giving test tiles to " << current.getName() << "...");
     
     current.clearRack();
     
@@ -635,12 +925,12 @@ void Game::givePlayerTestTiles() {
         current.addTileToRack(tile);
     }
     
-    std::cout << "Added tiles: A(1) B(3) C(3) D(2) E(1) F(4) G(2)" << std::endl;
-    std::cout << current.getName() << " now has " << current.getRack().size() << " tiles" << std::endl;
+    LOG_INFO("Added tiles: A(1) B(3) C(3) D(2) E(1) F(4) G(2)");
+    LOG_INFO(current.getName() << " now has " << current.getRack().size() << " tiles");
 }
 
 void Game::testScoring() {
-    std::cout << "\nTESTING SCORING SYSTEM" << std::endl;
+    LOG_INFO("TESTING SCORING SYSTEM");
     
     std::vector<std::pair<std::string, std::pair<int, int>>> testWords = {
         {"CAT", {7, 5}},
@@ -655,32 +945,308 @@ void Game::testScoring() {
         int col = test.second.second;
         
         int score = calculateWordScore(word, row, col, "HORIZONTAL");
-        std::cout << "Word: " << word << " at (" << row << "," << col << ") = " << score << " points" << std::endl;
+        LOG_INFO("Word: " << word << " at (" << row << "," << col << ") = " << score << " points");
     }
 }
 
 void Game::testDictionary() {
-    std::cout << "\nTESTING DICTIONARY" << std::endl;
+    LOG_INFO("TESTING DICTIONARY");
     
     std::vector<std::string> testWords = {
         "HELLO", "WORLD", "SCRABBLE", "COMPUTER", "GAME",
         "INVALID", "XYZZYX", "NOTAWORD", "APPLE", "HOUSE"
     };
     
-    std::cout << "Checking words from dictionary..." << std::endl;
+    LOG_INFO("Checking words from dictionary...");
     for (const std::string& word : testWords) {
         bool valid = isValidWord(word);
-        std::cout << word << " - " << (valid ? "VALID" : "INVALID") << std::endl;
+        LOG_INFO(word << " - " << (valid ? "VALID" : "INVALID"));
     }
 }
 
 void Game::resetBoard() {
-    std::cout << "\nClearing the board..." << std::endl;
+    LOG_INFO("Clearing the board...");
     board.clear();
-    std::cout << "Board cleared! Ready for new tiles." << std::endl;
+    LOG_INFO("Board cleared! Ready for new tiles.");
+}
+
+void Game::loadPosition(const Board& position, const std::vector<std::pair<int, int>>& pendingTiles) {
+    board = position;
+    currentWordPositions = pendingTiles;
+    wordInProgress = !pendingTiles.empty();
+}
+
+void Game::setSeed(uint32_t seed) {
+    gameSeed = seed;
+    fixedSeed = true;
+}
+
+void Game::setRecordFile(const std::string& filename) {
+    recordFile = filename;
+}
+
+const GameRecord& Game::getRecord() const {
+    return record;
+}
+
+void Game::captureGame(SavedGame& saved) const {
+    saved = SavedGame();
+    saved.seed = gameSeed;
+    saved.rngState = rngState;
+    saved.gameMode = static_cast<uint8_t>(gameMode);
+    saved.gameState = static_cast<uint8_t>(gameState == GameState::GAME_OVER ? GameState::GAME_OVER : GameState::PLAYING);
+    saved.currentPlayer = static_cast<uint8_t>(currentPlayerIndex);
+    saved.consecutivePasses = static_cast<uint8_t>(consecutivePasses);
+    saved.consecutiveFailures = static_cast<uint8_t>(consecutiveFailures);
+    saved.record = record;
+
+    const Player* players[2] = {&player1, &player2};
+    for (int p = 0; p < 2; ++p) {
+        saved.scores[p] = players[p]->getScore();
+        std::strncpy(saved.names[p], players[p]->getName().c_str(), SavedGame::NAME_BYTES - 1);
+        for (const Tile& tile : players[p]->getRack()) {
+            if (saved.rackSizes[p] < SavedGame::RACK_TILES) {
+                saved.racks[p][saved.rackSizes[p]++] = SavedGame::encodeTile(tile);
+            }
+        }
+    }
+
+    for (int row = 0; row < 15; ++row) {
+        for (int col = 0; col < 15; ++col) {
+            if (const Tile* tile = board.getTile(row, col)) {
+                saved.board[row * 15 + col] = SavedGame::encodeTile(*tile);
+            }
+        }
+    }
+    uint8_t& moverRackSize = saved.rackSizes[currentPlayerIndex];
+    for (const auto& pos : currentWordPositions) {
+        uint8_t& square = saved.board[pos.first * 15 + pos.second];
+        if (square && moverRackSize < SavedGame::RACK_TILES) {
+            saved.racks[currentPlayerIndex][moverRackSize++] = square;
+        }
+        square = 0;
+    }
+
+    std::queue<Tile> bag = tileBag;
+    while (!bag.empty() && saved.bagSize < SavedGame::BAG_TILES) {
+        saved.bag[saved.bagSize++] = SavedGame::encodeTile(bag.front());
+        bag.pop();
+    }
+}
+
+bool Game::restoreGame(const SavedGame& saved) {
+    if (saved.gameMode > static_cast<uint8_t>(GameMode::AI_VS_AI) ||
+        (saved.gameState != static_cast<uint8_t>(GameState::PLAYING) &&
+         saved.gameState != static_cast<uint8_t>(GameState::GAME_OVER))) {
+        return false;
+    }
+
+    board.clear();
+    for (int i = 0; i < SavedGame::BOARD_SQUARES; ++i) {
+        if (saved.board[i]) board.placeTile(i / 15, i % 15, SavedGame::decodeTile(saved.board[i]));
+    }
+
+    assignPlayers(static_cast<GameMode>(saved.gameMode), saved.names[0], saved.names[1]);
+    Player* players[2] = {&player1, &player2};
+    for (int p = 0; p < 2; ++p) {
+        players[p]->addScore(saved.scores[p]);
+        for (int i = 0; i < saved.rackSizes[p]; ++i) {
+            players[p]->addTileToRack(SavedGame::decodeTile(saved.racks[p][i]));
+        }
+    }
+
+    std::queue<Tile>().swap(tileBag);
+    for (int i = 0; i < saved.bagSize; ++i) {
+        tileBag.push(SavedGame::decodeTile(saved.bag[i]));
+    }
+
+    gameSeed = saved.seed;
+    rngState = saved.rngState;
+    record = saved.record;
+    gameState = static_cast<GameState>(saved.gameState);
+    gameOver = gameState == GameState::GAME_OVER;
+    currentPlayerIndex = saved.currentPlayer;
+    consecutivePasses = saved.consecutivePasses;
+    consecutiveFailures = saved.consecutiveFailures;
+    selectedTileIndex = 0;
+    currentWordPositions.clear();
+    currentWord.clear();
+    wordInProgress = false;
+    autosavedMoves = record.moves.size();
+    ++scoreVersion;
+    return true;
+}
+
+bool Game::saveGame(const std::string& filename) const {
+    TRACE_SCOPE("Game::saveGame");
+    SavedGame saved;
+    captureGame(saved);
+    return saved.writeFile(filename);
+}
+
+bool Game::loadGame(const std::string& filename) {
+    SavedGame saved;
+    if (!SavedGame::readFile(filename, saved)) return false;
+    if (!restoreGame(saved)) {
+        LOG_WARN("Save file does not describe a game in progress: " << filename);
+        return false;
+    }
+    LOG_INFO("Resumed " << player1.getName() << " vs " << player2.getName() << " from " << filename);
+    return true;
+}
+
+void Game::setAutosaveFile(const std::string& filename) {
+    autosaveFile = filename;
+}
+
+void Game::autosave() {
+    // Every turn adds to the record, so an unchanged record means nothing to save
+    if (autosaveFile.empty() || gameState == GameState::MENU || record.moves.size() == autosavedMoves) return;
+    autosavedMoves = record.moves.size();
+
+    if (gameState == GameState::GAME_OVER) {
+        std::remove(autosaveFile.c_str());
+    } else {
+        saveGame(autosaveFile);
+    }
+}
+
+int Game::getPlayerIndex(const Player& player) const {
+    return &player == &player1 ? 0 : 1;
+}
+
+void Game::recordMove(RecordedMoveType type, int playerIndex, int score) {
+    RecordedMove move = {type, static_cast<uint8_t>(playerIndex), 0, 0, static_cast<int16_t>(score), {0}, {0}};
+    if (type == RecordedMoveType::PLAY) {
+        for (const auto& pos : currentWordPositions) {
+            const Tile* tile = board.getTile(pos.first, pos.second);
+            if (!tile || move.tileCount >= RecordedMove::MAX_TILES) continue;
+
+            if (tile->getIsBlank()) move.blankMask |= 1 << move.tileCount;
+            move.squares[move.tileCount] = static_cast<uint8_t>(pos.first * 15 + pos.second);
+            move.letters[move.tileCount] = tile->getLetter();
+            ++move.tileCount;
+        }
+    }
+    record.moves.push_back(move);
+}
+
+bool Game::replayRecord(const GameRecord& game) {
+    if (game.gameMode > static_cast<uint8_t>(GameMode::AI_VS_AI)) return false;
+
+    gameMode = static_cast<GameMode>(game.gameMode);
+    board.clear();
+    player1.resetScore();
+    player1.clearRack();
+    player2.resetScore();
+    player2.clearRack();
+    rngState = game.seed;
+    initializeTileBag();
+    const bool seededRacks = !(game.flags & GameRecord::FLAG_EXTERNAL_RACKS);
+    if (seededRacks) {
+        drawUntilFull(player1);
+        drawUntilFull(player2);
+    }
+
+    gameState = GameState::PLAYING;
+    gameOver = false;
+    currentPlayerIndex = 0;
+    selectedTileIndex = 0;
+    consecutivePasses = 0;
+    consecutiveFailures = 0;
+    currentWordPositions.clear();
+    currentWord.clear();
+    wordInProgress = false;
+    record = game;
+    ++scoreVersion;
+
+    for (const RecordedMove& move : game.moves) {
+        if (move.player > 1 || move.tileCount > RecordedMove::MAX_TILES) return false;
+        Player& player = move.player == 0 ? player1 : player2;
+
+        switch (move.type) {
+            case RecordedMoveType::PLAY:
+                if (!seededRacks) {
+                    // Imported games only know the tiles that reached the board
+                    for (int i = 0; i < move.tileCount; ++i) {
+                        Tile tile;
+                        if (!((move.blankMask >> i) & 1)) {
+                            tile = Tile(move.letters[i]);
+                        } else if (move.letters[i] != ' ') {
+                            tile.setLetter(move.letters[i]);
+                        }
+                        if (move.squares[i] >= 15 * 15 ||
+                            !board.placeTile(move.squares[i] / 15, move.squares[i] % 15, tile)) {
+                            return false;
+                        }
+                    }
+                    player.addScore(move.score);
+                    consecutivePasses = 0;
+                    consecutiveFailures = 0;
+                    currentPlayerIndex = 1 - move.player;
+                    break;
+                }
+                for (int i = 0; i < move.tileCount; ++i) {
+                    const bool blank = (move.blankMask >> i) & 1;
+                    const std::vector<Tile>& rack = player.getRack();
+                    int rackIndex = -1;
+                    for (size_t r = 0; r < rack.size() && rackIndex < 0; ++r) {
+                        if (rack[r].getIsBlank() == blank && (blank || rack[r].getLetter() == move.letters[i])) {
+                            rackIndex = static_cast<int>(r);
+                        }
+                    }
+                    if (move.squares[i] >= 15 * 15 || rackIndex < 0) return false;
+
+                    Tile tile = rack[rackIndex];
+                    if (blank && move.letters[i] != ' ') {
+                        tile.setLetter(move.letters[i]);
+                    }
+                    if (!board.placeTile(move.squares[i] / 15, move.squares[i] % 15, tile)) {
+                        return false;
+                    }
+                    player.removeTileFromRack(rackIndex);
+                }
+                player.addScore(move.score);
+                consecutivePasses = 0;
+                consecutiveFailures = 0;
+                drawUntilFull(player1);
+                drawUntilFull(player2);
+                currentPlayerIndex = 1 - move.player;
+                break;
+
+            case RecordedMoveType::PASS:
+                // The last pass ends the game before anyone draws
+                if (++consecutivePasses < MAX_CONSECUTIVE_PASSES && seededRacks) {
+                    drawUntilFull(player1);
+                    drawUntilFull(player2);
+                }
+                currentPlayerIndex = 1 - move.player;
+                break;
+
+            case RecordedMoveType::INVALID_WORD:
+                ++consecutiveFailures;
+                currentPlayerIndex = move.player;
+                break;
+
+            case RecordedMoveType::BONUS:
+                player.addScore(move.score);
+                break;
+
+            case RecordedMoveType::GAME_END:
+                gameState = GameState::GAME_OVER;
+                gameOver = true;
+                currentPlayerIndex = move.player;
+                break;
+
+            default:
+                return false;
+        }
+    }
+    return true;
 }
 
 void Game::handleEvents() {
+    TRACE_SCOPE("Game::handleEvents");
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
         switch (event.type) {
@@ -693,56 +1259,92 @@ void Game::handleEvents() {
                     mouseX = static_cast<int>(event.button.x);
                     mouseY = static_cast<int>(event.button.y);
                     
-                    std::cout << "Mouse click detected in state: " << static_cast<int>(gameState) 
-                              << " at (" << mouseX << ", " << mouseY << ")" << std::endl;
+                    LOG_DEBUG("Mouse click detected in state: " << static_cast<int>(snapshots.read().gameState)
+                              << " at (" << mouseX << ", " << mouseY << ")");
                     
-                    handleMouseClick(mouseX, mouseY);
+                    // The result arrives with the next snapshot
+                    postInput({InputCommand::Type::MOUSE_CLICK, mouseX, mouseY, SDLK_UNKNOWN});
+                    if (updateHoverCell(mouseX, mouseY)) {
+                        markDirty();
+                    } else {
+                        lastActivityTime = SDL_GetTicks();
+                    }
                 }
                 break;
                 
             case SDL_EVENT_MOUSE_MOTION:
                 mouseX = static_cast<int>(event.motion.x);
                 mouseY = static_cast<int>(event.motion.y);
+                // Only the hovered cell is drawn, so moving inside it changes nothing
+                if (updateHoverCell(mouseX, mouseY)) {
+                    markDirty();
+                } else {
+                    lastActivityTime = SDL_GetTicks();
+                }
                 break;
                 
             case SDL_EVENT_KEY_DOWN:
-                handleKeyPress(event.key.key);
+                if (event.key.key == SDLK_F3) {
+                    togglePerfHud();
+                    markDirty();
+                } else {
+                    postInput({InputCommand::Type::KEY_PRESS, 0, 0, event.key.key});
+                    lastActivityTime = SDL_GetTicks();
+                }
+                break;
+
+            case SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED:
+            case SDL_EVENT_RENDER_TARGETS_RESET:
+                gameRenderer->invalidateRenderTargets();
+                markDirty();
+                break;
+
+            case SDL_EVENT_RENDER_DEVICE_RESET:
+                gameRenderer->recreateDeviceTextures();
+                markDirty();
+                break;
+
+            case SDL_EVENT_WINDOW_EXPOSED:
+            case SDL_EVENT_WINDOW_SHOWN:
+            case SDL_EVENT_WINDOW_RESTORED:
+            case SDL_EVENT_WINDOW_FOCUS_GAINED:
+                markDirty();
                 break;
         }
     }
 }
 
 bool Game::handleMouseClick(int x, int y) {
-    std::cout << "handleMouseClick called: (" << x << ", " << y << ") in state " << static_cast<int>(gameState) << std::endl;
+    LOG_DEBUG("handleMouseClick called: (" << x << ", " << y << ") in state " << static_cast<int>(gameState));
 
     // === MENU STATE HANDLING ===
     if (gameState == GameState::MENU) {
-        std::cout << "In MENU state, checking buttons..." << std::endl;
+        LOG_DEBUG("In MENU state, checking buttons...");
         
         if (gameRenderer->isPointInStartButton(x, y)) {
-            std::cout << "Start button clicked!" << std::endl;
+            LOG_DEBUG("Start button clicked!");
             if (!setupGame(GameMode::HUMAN_VS_HUMAN, "Player 1", "Player 2")) {
-                std::cerr << "Failed to setup game!" << std::endl;
+                LOG_ERROR("Failed to setup game!");
                 return false;
             }
             gameState = GameState::PLAYING;
-            std::cout << "Game started!" << std::endl;
+            LOG_INFO("Game started!");
             return true;
         }
         
         if (gameRenderer->isPointInTutorialButton(x, y)) {
-            std::cout << "Tutorial button clicked!" << std::endl;
-            GameRenderer::toggleTutorial();
+            LOG_DEBUG("Tutorial button clicked!");
+            tutorialVisible = !tutorialVisible;
             return true;
         }
         
         if (gameRenderer->isPointInExitButton(x, y)) {
-            std::cout << "Exit button clicked!" << std::endl;
+            LOG_DEBUG("Exit button clicked!");
             isRunning = false;
             return true;
         }
         
-        std::cout << "Clicked elsewhere on menu" << std::endl;
+        LOG_DEBUG("Clicked elsewhere on menu");
         return false; // Don't start game on random clicks
     }
     
@@ -753,33 +1355,33 @@ bool Game::handleMouseClick(int x, int y) {
         }
         // If click was outside pause menu, resume game
         gameState = GameState::PLAYING;
-        std::cout << "Game resumed by clicking outside pause menu!" << std::endl;
+        LOG_DEBUG("Game resumed by clicking outside pause menu!");
         return true;
     }
     
     // === GAME OVER STATE HANDLING ===
     if (gameState == GameState::GAME_OVER) {
-        std::cout << "In GAME_OVER state, checking buttons..." << std::endl;
+        LOG_DEBUG("In GAME_OVER state, checking buttons...");
         
         if (gameRenderer->isPointInPlayAgainButton(x, y)) {
-            std::cout << "Play Again button clicked!" << std::endl;
+            LOG_DEBUG("Play Again button clicked!");
             startNewGame();
             return true;
         }
         
         if (gameRenderer->isPointInMainMenuButton(x, y)) {
-            std::cout << "Main Menu button clicked!" << std::endl;
+            LOG_DEBUG("Main Menu button clicked!");
             gameState = GameState::MENU;
             return true;
         }
         
         if (gameRenderer->isPointInGameOverExitButton(x, y)) {
-            std::cout << "Exit button clicked!" << std::endl;
+            LOG_DEBUG("Exit button clicked!");
             isRunning = false;
             return true;
         }
         
-        std::cout << "Clicked elsewhere on game over screen" << std::endl;
+        LOG_DEBUG("Clicked elsewhere on game over screen");
         return false;
     }
     
@@ -787,7 +1389,7 @@ bool Game::handleMouseClick(int x, int y) {
     if (gameRenderer && gameRenderer->isPointInPauseButton(x, y)) {
         if (gameState == GameState::PLAYING || gameState == GameState::PLACING_TILES) {
             gameState = GameState::PAUSED;
-            std::cout << "Game paused!" << std::endl;
+            LOG_INFO("Game paused!");
             return true;
         }
     }
@@ -796,7 +1398,7 @@ bool Game::handleMouseClick(int x, int y) {
     if (gameState == GameState::PLAYING || gameState == GameState::PLACING_TILES) {
         // SWITCH TURN button
         if (gameRenderer->isPointInSwitchTurnButton(x, y)) {
-            std::cout << "Switch Turn button clicked!" << std::endl;
+            LOG_DEBUG("Switch Turn button clicked!");
             skipTurn();
             return true;
         }
@@ -804,11 +1406,11 @@ bool Game::handleMouseClick(int x, int y) {
         // SUBMIT button (only active when placing tiles)
         if (gameRenderer->isPointInSubmitButton(x, y)) {
             if (gameState == GameState::PLACING_TILES) {
-                std::cout << "Submit button clicked!" << std::endl;
+                LOG_DEBUG("Submit button clicked!");
                 validateCurrentWord();
                 return true;
             } else {
-                std::cout << "Submit button clicked but no word in progress" << std::endl;
+                LOG_DEBUG("Submit button clicked but no word in progress");
             }
             return true;
         }
@@ -816,11 +1418,11 @@ bool Game::handleMouseClick(int x, int y) {
         // CANCEL button (only active when placing tiles)
         if (gameRenderer->isPointInCancelButton(x, y)) {
             if (gameState == GameState::PLACING_TILES) {
-                std::cout << "Cancel button clicked!" << std::endl;
+                LOG_DEBUG("Cancel button clicked!");
                 cancelWord();
                 return true;
             } else {
-                std::cout << "Cancel button clicked but no word in progress" << std::endl;
+                LOG_DEBUG("Cancel button clicked but no word in progress");
             }
             return true;
         }
@@ -828,13 +1430,13 @@ bool Game::handleMouseClick(int x, int y) {
     
     // === PLAYING STATE HANDLING ===
     if (gameState != GameState::PLAYING && gameState != GameState::PLACING_TILES) {
-        std::cout << "Not in a playable state" << std::endl;
+        LOG_DEBUG("Not in a playable state");
         return false;
     }
     
     int row, col;
     if (gameRenderer->isPointInBoard(x, y, row, col)) {
-        std::cout << "Clicked on board cell: (" << row << ", " << col << ")" << std::endl;
+        LOG_DEBUG("Clicked on board cell: (" << row << ", " << col << ")");
         
         if (gameState == GameState::PLAYING) {
             startWordPlacement();
@@ -846,12 +1448,12 @@ bool Game::handleMouseClick(int x, int y) {
     // Check if click is on rack
     int rackIndex = getRackTileIndexFromMouse(x, y);
     if (rackIndex >= 0) {
-        std::cout << "Clicked on rack tile: " << rackIndex << std::endl;
+        LOG_DEBUG("Clicked on rack tile: " << rackIndex);
         selectTileFromRack(rackIndex);
         return true;
     }
     
-    std::cout << "Clicked outside interactive areas" << std::endl;
+    LOG_DEBUG("Clicked outside interactive areas");
     return false;
 }
 
@@ -861,21 +1463,21 @@ bool Game::handlePauseMenuClick(int x, int y) {
     switch (option) {
         case PauseMenuOption::CONTINUE:
             gameState = GameState::PLAYING;
-            std::cout << "Game resumed" << std::endl;
+            LOG_INFO("Game resumed");
             return true;
             
         case PauseMenuOption::SURRENDER:
-            std::cout << getCurrentPlayer().getName() << " surrendered!" << std::endl;
+            LOG_INFO(getCurrentPlayer().getName() << " surrendered!");
             endGame();
             return true;
             
         case PauseMenuOption::NEW_GAME:
-            std::cout << "Starting new game..." << std::endl;
+            LOG_INFO("Starting new game...");
             startNewGame();
             return true;
             
         case PauseMenuOption::QUIT:
-            std::cout << "Quitting game..." << std::endl;
+            LOG_INFO("Quitting game...");
             isRunning = false;
             return true;
             
@@ -934,15 +1536,7 @@ void Game::startWordPlacement() {
         gameState = GameState::PLACING_TILES;
         
         const auto& rack = getCurrentPlayer().getRack();
-        std::cout << "Your tiles: ";
-        for (size_t i = 0; i < rack.size(); i++) {
-            if (i == selectedTileIndex) {
-                std::cout << "[>" << rack[i].getLetter() << "<](" << rack[i].getPoints() << ") ";
-            } else {
-                std::cout << "[" << rack[i].getLetter() << "](" << rack[i].getPoints() << ") ";
-            }
-        }
-        std::cout << std::endl;
+        LOG_DEBUG("Your tiles: " << formatRack(rack, selectedTileIndex, true));
     }
 }
 
@@ -974,33 +1568,24 @@ bool Game::placeTileFromRack(int row, int col) {
         currentPlayer.removeTileFromRack(selectedTileIndex);
         currentWordPositions.push_back({row, col});
 
-        std::cout << "Placed tile '" << tileToPlace.getLetter() 
-                  << "' at (" << row << ", " << col << ")" << std::endl;
-        std::cout << "Press ENTER to confirm word, or BACKSPACE to cancel" << std::endl;
+        LOG_DEBUG("Placed tile '" << tileToPlace.getLetter() << "' at (" << row << ", " << col << ")");
+        LOG_DEBUG("Press ENTER to confirm word, or BACKSPACE to cancel");
         
         if (!rack.empty()) {
             if (selectedTileIndex >= static_cast<int>(rack.size())) {
                 selectedTileIndex = rack.size() - 1;
             }
             
-            std::cout << "Updated rack: ";
-            for (size_t i = 0; i < rack.size(); i++) {
-                if (i == selectedTileIndex) {
-                    std::cout << "[>" << rack[i].getLetter() << "<] ";
-                } else {
-                    std::cout << "[" << rack[i].getLetter() << "] ";
-                }
-            }
-            std::cout << std::endl;
+            LOG_DEBUG("Updated rack: " << formatRack(rack, selectedTileIndex, false));
             
-            std::cout << "Now selected: " << rack[selectedTileIndex].getLetter() 
-                      << " at position " << (selectedTileIndex + 1) << "/" << rack.size() << std::endl;
+            LOG_DEBUG("Now selected: " << rack[selectedTileIndex].getLetter()
+                      << " at position " << (selectedTileIndex + 1) << "/" << rack.size());
         } else {
             selectedTileIndex = 0;
-            std::cout << "Rack is now empty!" << std::endl;
+            LOG_DEBUG("Rack is now empty!");
         }
         
-        std::cout << "Press ENTER to confirm word, or BACKSPACE to cancel" << std::endl;
+        LOG_DEBUG("Press ENTER to confirm word, or BACKSPACE to cancel");
         gameState = GameState::PLACING_TILES;
         return true;
     }
@@ -1040,26 +1625,27 @@ bool Game::wouldCrossCenter(int row, int col) const {
 }
 
 bool Game::validateCurrentWord() {
+    TRACE_SCOPE("Game::validateCurrentWord");
     if (currentWordPositions.empty()) {
-        std::cout << "No tiles placed yet!" << std::endl;
+        LOG_INFO("No tiles placed yet!");
         return false;
     }
 
     std::vector<WordInfo> allWords = findAllWordsFormed();
     
     if (allWords.empty()) {
-        std::cout << "No valid words formed!" << std::endl;
+        LOG_INFO("No valid words formed!");
         return false;
     }
 
-    std::cout << "Checking all words formed:" << std::endl;
+    LOG_DEBUG("Checking all words formed:");
     for (const auto& wordInfo : allWords) {
-        std::cout << "  '" << wordInfo.word << "' (" 
-                  << (wordInfo.isHorizontal ? "horizontal" : "vertical") << ")" << std::endl;
+        LOG_DEBUG("  '" << wordInfo.word << "' (" << (wordInfo.isHorizontal ? "horizontal" : "vertical") << ")");
         
         if (!isValidWord(wordInfo.word)) {
-            std::cout << "Invalid word found: '" << wordInfo.word << "'" << std::endl;
-            std::cout << "All words must be valid! Canceling move..." << std::endl;
+            LOG_INFO("Invalid word found: '" << wordInfo.word << "'");
+            LOG_INFO("All words must be valid! Canceling move...");
+            recordMove(RecordedMoveType::INVALID_WORD, currentPlayerIndex);
             cancelWord();
             consecutiveFailures++;
             getCurrentPlayer().shuffleRack();
@@ -1072,19 +1658,19 @@ bool Game::validateCurrentWord() {
     }
 
     int totalScore = 0;
-    std::cout << "All words are valid! Calculating scores:" << std::endl;
+    LOG_INFO("All words are valid! Calculating scores:");
     
     for (const auto& wordInfo : allWords) {
         int wordScore = calculateWordScore(wordInfo);
         totalScore += wordScore;
-        std::cout << "  '" << wordInfo.word << "' = " << wordScore << " points" << std::endl;
+        LOG_DEBUG("  '" << wordInfo.word << "' = " << wordScore << " points");
     }
 
-    getCurrentPlayer().addScore(totalScore);
+    recordMove(RecordedMoveType::PLAY, currentPlayerIndex, totalScore);
+    awardPoints(getCurrentPlayer(), totalScore);
     
-    std::cout << "Total score: " << totalScore << " points added!" << std::endl;
-    std::cout << getCurrentPlayer().getName() 
-              << " total score: " << getCurrentPlayer().getScore() << std::endl;
+    LOG_INFO("Total score: " << totalScore << " points added!");
+    LOG_INFO(getCurrentPlayer().getName() << " total score: " << getCurrentPlayer().getScore());
 
     currentWordPositions.clear();
     gameState = GameState::PLAYING;
@@ -1094,145 +1680,15 @@ bool Game::validateCurrentWord() {
 }
 
 std::vector<WordInfo> Game::findAllWordsFormed() const {
-    std::vector<WordInfo> allWords;
-    std::set<std::string> processedWords;
-    
-    if (currentWordPositions.empty()) return allWords;
-    
-    auto sortedPositions = currentWordPositions;
-    std::sort(sortedPositions.begin(), sortedPositions.end(), 
-        [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
-            if (a.first == b.first) return a.second < b.second;
-            return a.first < b.first;
-        });
-    
-    bool mainIsHorizontal = (sortedPositions[0].first == sortedPositions.back().first);
-    
-    WordInfo mainWord = findWordAtPosition(
-        sortedPositions[0].first, 
-        sortedPositions[0].second, 
-        mainIsHorizontal
-    );
-    
-    if (mainWord.word.length() > 1) {
-        for (const auto& pos : currentWordPositions) {
-            if (std::find(mainWord.positions.begin(), mainWord.positions.end(), pos) != mainWord.positions.end()) {
-                mainWord.newTilePositions.push_back(pos);
-            }
-        }
-        allWords.push_back(mainWord);
-        processedWords.insert(mainWord.word + std::to_string(mainWord.startRow) + std::to_string(mainWord.startCol));
-    }
-
-    for (const auto& pos : currentWordPositions) {
-        WordInfo crossWord = findWordAtPosition(pos.first, pos.second, !mainIsHorizontal);
-        
-        if (crossWord.word.length() > 1) {
-            std::string key = crossWord.word + std::to_string(crossWord.startRow) + std::to_string(crossWord.startCol);
-            if (processedWords.find(key) == processedWords.end()) {
-                crossWord.newTilePositions.push_back(pos);
-                allWords.push_back(crossWord);
-                processedWords.insert(key);
-            }
-        }
-    }
-    
-    return allWords;
+    return Rules::findAllWordsFormed(board, currentWordPositions);
 }
 
 WordInfo Game::findWordAtPosition(int row, int col, bool horizontal) const {
-    WordInfo wordInfo;
-    wordInfo.isHorizontal = horizontal;
-    
-    if (horizontal) {
-        int startCol = col;
-        int endCol = col;
-        
-        while (startCol > 0 && board.getTile(row, startCol - 1) != nullptr) {
-            startCol--;
-        }
-        
-        while (endCol < 14 && board.getTile(row, endCol + 1) != nullptr) {
-            endCol++;
-        }
-        
-        wordInfo.startRow = row;
-        wordInfo.startCol = startCol;
-        
-        for (int c = startCol; c <= endCol; c++) {
-            const Tile* tile = board.getTile(row, c);
-            if (tile) {
-                wordInfo.word += tile->getLetter();
-                wordInfo.positions.push_back({row, c});
-            }
-        }
-    } else {
-        int startRow = row;
-        int endRow = row;
-        
-        while (startRow > 0 && board.getTile(startRow - 1, col) != nullptr) {
-            startRow--;
-        }
-        
-        while (endRow < 14 && board.getTile(endRow + 1, col) != nullptr) {
-            endRow++;
-        }
-        
-        wordInfo.startRow = startRow;
-        wordInfo.startCol = col;
-        
-        for (int r = startRow; r <= endRow; r++) {
-            const Tile* tile = board.getTile(r, col);
-            if (tile) {
-                wordInfo.word += tile->getLetter();
-                wordInfo.positions.push_back({r, col});
-            }
-        }
-    }
-    
-    return wordInfo;
+    return Rules::findWordAtPosition(board, row, col, horizontal);
 }
 
 int Game::calculateWordScore(const WordInfo& wordInfo) const {
-    int score = 0;
-    int wordMultiplier = 1;
-    
-    for (const auto& pos : wordInfo.positions) {
-        const Tile* tile = board.getTile(pos.first, pos.second);
-        if (tile) {
-            int letterPoints = tile->getPoints();
-            
-            bool isNewlyPlaced = std::find(wordInfo.newTilePositions.begin(), 
-                                         wordInfo.newTilePositions.end(), 
-                                         pos) != wordInfo.newTilePositions.end();
-            
-            if (isNewlyPlaced) {
-                SpecialSquare special = board.getSpecialSquare(pos.first, pos.second);
-                
-                switch (special) {
-                    case SpecialSquare::DOUBLE_LETTER:
-                        letterPoints *= 2;
-                        break;
-                    case SpecialSquare::TRIPLE_LETTER:
-                        letterPoints *= 3;
-                        break;
-                    case SpecialSquare::DOUBLE_WORD:
-                    case SpecialSquare::CENTER:
-                        wordMultiplier *= 2;
-                        break;
-                    case SpecialSquare::TRIPLE_WORD:
-                        wordMultiplier *= 3;
-                        break;
-                    default:
-                        break;
-                }
-            }
-            
-            score += letterPoints;
-        }
-    }
-    
-    return score * wordMultiplier;
+    return Rules::calculateWordScore(board, wordInfo);
 }
 
 void Game::cancelWord() {
@@ -1342,7 +1798,7 @@ bool Game::handleKeyPress(SDL_Keycode key) {
                 skipTurn();
             } else if (gameState == GameState::PAUSED) {
                 gameState = GameState::PLAYING;
-                std::cout << "Game resumed!" << std::endl;
+                LOG_INFO("Game resumed!");
             }
             break;
         case SDLK_S:
@@ -1353,18 +1809,10 @@ bool Game::handleKeyPress(SDL_Keycode key) {
                     selectedTileIndex = rack.empty() ? 0 : rack.size() - 1;
                 }
                 
-                std::cout << getCurrentPlayer().getName() << "'s rack shuffled!" << std::endl;
+                LOG_INFO(getCurrentPlayer().getName() << "'s rack shuffled!");
                 
                 if (!rack.empty()) {
-                    std::cout << "Rack: ";
-                    for (size_t i = 0; i < rack.size(); i++) {
-                        if (i == selectedTileIndex) {
-                            std::cout << "[>" << rack[i].getLetter() << "<] ";
-                        } else {
-                            std::cout << "[" << rack[i].getLetter() << "] ";
-                        }
-                    }
-                    std::cout << std::endl;
+                    LOG_DEBUG("Rack: " << formatRack(rack, selectedTileIndex, false));
                 }
             }
             break;
@@ -1394,7 +1842,7 @@ bool Game::handleKeyPress(SDL_Keycode key) {
             
         case SDLK_T:
             switchTurn();
-            std::cout << "Switched to Player " << (getCurrentPlayerIndex() + 1) << std::endl;
+            LOG_INFO("Switched to Player " << (getCurrentPlayerIndex() + 1));
             break;
 
         case SDLK_LEFT:
@@ -1462,7 +1910,7 @@ std::vector<TilePlacement> Game::getCurrentWord() const {
 }
 
 void Game::refreshBothPlayerRacks() {
-    std::cout << "Refreshing both players' racks..." << std::endl;
+    LOG_INFO("Refreshing both players' racks...");
     player1.shuffleRack();
     player2.shuffleRack();
     
@@ -1473,7 +1921,7 @@ void Game::refreshBothPlayerRacks() {
         drawTilesForPlayer(player2, 1);
     }
     
-    std::cout << "Both players' racks have been refreshed and filled!" << std::endl;
+    LOG_INFO("Both players' racks have been refreshed and filled!");
 }
 
 void Game::handleTurnCompletion(bool wordSuccess) {
@@ -1491,13 +1939,13 @@ void Game::handleTurnCompletion(bool wordSuccess) {
 
 bool Game::checkFailureGameEnd() {
     if (consecutiveFailures >= MAX_CONSECUTIVE_FAILURES) {
-        std::cout << "🔚 Game ending due to " << MAX_CONSECUTIVE_FAILURES 
-                  << " consecutive word validation failures!" << std::endl;
+        LOG_INFO("🔚 Game ending due to " << MAX_CONSECUTIVE_FAILURES << " consecutive word validation failures!");
         
         Player& winner = getOtherPlayer();
-        winner.addScore(50);
+        recordMove(RecordedMoveType::BONUS, getPlayerIndex(winner), 50);
+        awardPoints(winner, 50);
         
-        std::cout << winner.getName() << " wins due to opponent's failures!" << std::endl;
+        LOG_INFO(winner.getName() << " wins due to opponent's failures!");
         endGame();
         return true;
     }
@@ -3,10 +3,19 @@
 #include "Player.hpp"
 #include "Dictionary.hpp"
 #include "Tile.hpp"
+#include "FrameScheduler.hpp"
+#include "GameRecord.hpp"
+#include "SavedGame.hpp"
+#include "TripleBuffer.hpp"
 #include <vector>
 #include <queue>
 #include <string>
 #include <memory>
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
 #include <SDL3/SDL.h>
 
 class GameRenderer;
@@ -39,13 +48,26 @@ enum class PauseMenuOption {
     QUIT
 };
 
-// process cross word
-struct WordInfo {
-    std::string word;
-    int startRow, startCol;
-    bool isHorizontal;
-    std::vector<std::pair<int, int>> positions;
-    std::vector<std::pair<int, int>> newTilePositions;
+// What the renderer draws, copied out of the game after every update. The
+// simulation thread writes these and the main thread only reads them, so a
+// slow move never holds up a frame.
+struct GameSnapshot {
+    Board board;
+    Player player1;
+    Player player2;
+    GameState gameState;
+    GameMode gameMode;
+    int currentPlayerIndex;
+    int selectedTileIndex;
+    std::vector<std::pair<int, int>> currentWordPositions;
+    size_t tileBagSize;
+    bool tutorialVisible;
+    uint64_t scoreVersion;     // changes whenever a score does
+
+    GameSnapshot();
+
+    const Player& getCurrentPlayer() const;
+    std::vector<TilePlacement> getCurrentWord() const;   // tiles point into `board`
 };
 
 class Game {
@@ -57,6 +79,18 @@ private:
     Player player2;
     Dictionary dictionary;
     std::queue<Tile> tileBag;
+
+    // The tile bag is shuffled from the game's seed, so a record of the seed
+    // and the moves rebuilds the whole game
+    uint32_t gameSeed;
+    bool fixedSeed;
+    uint64_t rngState;
+    GameRecord record;
+    std::string recordFile;
+
+    // Crash recovery: the position is saved whenever the record grows
+    std::string autosaveFile;
+    size_t autosavedMoves;
     
     // Game state
     GameState gameState;
@@ -74,7 +108,7 @@ private:
     // SDL components
     SDL_Window* window;
     SDL_Renderer* renderer;
-    bool isRunning;
+    std::atomic<bool> isRunning;
     
     // UI component
     std::unique_ptr<GameRenderer> gameRenderer;
@@ -89,9 +123,87 @@ private:
     void initializeTileBag();
     bool drawTilesForPlayer(Player& player, int count = 1);
     void fillPlayerRacks();
+    void drawUntilFull(Player& player);
+    void recordMove(RecordedMoveType type, int playerIndex, int score = 0);
+    int getPlayerIndex(const Player& player) const;
+    void assignPlayers(GameMode mode, const std::string& player1Name, const std::string& player2Name);
+    void autosave();
 
     int mouseX, mouseY;
     bool mouseOnBoard;
+
+    // Redraw tracking: frames are only drawn when something changed or an
+    // animated screen is showing, otherwise the loop sleeps in SDL_WaitEvent
+    static const int TARGET_FRAME_RATE = 60;
+    static const Uint64 AMBIENT_ANIMATION_TIMEOUT_MS = 10000;
+    bool needsRedraw;
+    int hoverRow, hoverCol;
+    Uint64 lastActivityTime;
+    FrameScheduler frameScheduler;
+
+    // Performance HUD (F3): redrawn every refresh interval while visible,
+    // lookup rate sampled over the same window
+    static const Uint64 PERF_HUD_REFRESH_MS = 250;
+    bool perfHudVisible;
+    Uint64 lastPerfHudRefresh;
+    uint64_t lastLookupCount;
+    double lookupsPerSecond;
+
+    void markDirty();
+    bool updateHoverCell(int x, int y);
+    bool isAnimating() const;
+    void waitForEvents();
+    void togglePerfHud();
+    bool isPerfHudRefreshDue(Uint64 now) const;
+    void renderPerfHud();
+
+    // Game logic runs on the simulation thread, which owns every field above
+    // (except the SDL and redraw state) once started. The main thread polls
+    // events, forwards clicks and keys here and draws the latest snapshot.
+    struct InputCommand {
+        enum class Type { MOUSE_CLICK, KEY_PRESS } type;
+        int x, y;
+        SDL_Keycode key;
+    };
+    std::thread simulationThread;
+    std::mutex inputMutex;
+    std::condition_variable inputReady;
+    std::vector<InputCommand> inputQueue;
+    bool stopRequested;
+    TripleBuffer<GameSnapshot> snapshots;
+    Uint32 snapshotEventType;
+    std::atomic<bool> wakePending;
+    bool tutorialVisible;
+    uint64_t scoreVersion;
+    uint64_t drawnScoreVersion;    // main thread: score text cached for this version
+
+    void startSimulation();
+    void stopSimulation();
+    void simulationLoop();
+    void postInput(const InputCommand& command);
+    bool isAITurn() const;
+    void publishSnapshot();
+    void applySnapshot(const GameSnapshot& snapshot);
+
+    // Start-up phases are timed from initialize() and reported with the
+    // first frame. The word lists load on their own thread; the first thing
+    // that needs the dictionary (normally Start) waits for it.
+    struct StartupPhase {
+        const char* name;
+        uint64_t nanos;
+    };
+    std::vector<StartupPhase> startupPhases;
+    uint64_t startupBegin;
+    uint64_t phaseBegin;
+    bool startupReported;
+    std::shared_future<bool> dictionaryLoad;
+
+    void markStartupPhase(const char* name);
+    void reportStartup();
+    void startDictionaryLoad(const std::vector<std::string>& filenames);
+    void waitForDictionary() const;
+
+    void awardPoints(Player& player, int points);
     
 public:
     Game();
@@ -105,7 +217,26 @@ public:
     bool setupGame(GameMode mode, const std::string& player1Name, 
                    const std::string& player2Name = "Computer");
     bool loadDictionary(const std::string& filename);
+    bool loadDictionaries(const std::vector<std::string>& filenames);
     bool handlePauseMenuClick(int x, int y);
+
+    // Game records: the next setupGame() uses `seed` instead of a random one,
+    // and every finished game is appended to `filename` when it is set.
+    void setSeed(uint32_t seed);
+    void setRecordFile(const std::string& filename);
+    const GameRecord& getRecord() const;
+    // Rebuilds the board, scores, racks and bag from a record without
+    // validating words or logging; returns false if the record does not fit.
+    bool replayRecord(const GameRecord& game);
+
+    // Position snapshots between turns. Tiles placed but not yet submitted go
+    // back to the rack. With an autosave file the game is saved after every
+    // turn and the file is removed when the game ends.
+    void captureGame(SavedGame& saved) const;
+    bool restoreGame(const SavedGame& saved);
+    bool saveGame(const std::string& filename) const;
+    bool loadGame(const std::string& filename);
+    void setAutosaveFile(const std::string& filename);
     
     // Game flow
     void run();
@@ -144,6 +275,8 @@ public:
     void testScoring();
     void testDictionary();
     void resetBoard();
+    // Replaces the board and the tiles of the word being built, e.g. with a recorded position
+    void loadPosition(const Board& position, const std::vector<std::pair<int, int>>& pendingTiles);
 
     // Tracking tile
     void selectTileFromRack(int index);
@@ -164,7 +297,7 @@ public:
     bool handleMouseClick(int x, int y);
     bool handleKeyPress(SDL_Keycode key);
     
-    // Getters for GameRenderer to access game state
+    // Game state getters; only valid on the simulation thread while it runs
     const Board& getBoard() const;
     GameState getGameState() const;
     GameMode getGameMode() const;
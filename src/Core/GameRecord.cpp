@@ -0,0 +1,154 @@
+#include "GameRecord.hpp"
+#include "Logger.hpp"
+#include <fstream>
+
+static const int BOARD_SQUARES = 15 * 15;
+
+static void putU16(std::vector<uint8_t>& out, uint16_t value) {
+    out.push_back(static_cast<uint8_t>(value));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+static void putU32(std::vector<uint8_t>& out, uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) out.push_back(static_cast<uint8_t>(value >> shift));
+}
+
+static void putU64(std::vector<uint8_t>& out, uint64_t value) {
+    for (int shift = 0; shift < 64; shift += 8) out.push_back(static_cast<uint8_t>(value >> shift));
+}
+
+static uint16_t getU16(const uint8_t* data) {
+    return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+
+static uint32_t getU32(const uint8_t* data) {
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+           (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+static uint64_t getU64(const uint8_t* data) {
+    return static_cast<uint64_t>(getU32(data)) | (static_cast<uint64_t>(getU32(data + 4)) << 32);
+}
+
+GameRecord::GameRecord() : seed(0), lexiconId(0), gameMode(0), flags(0) {}
+
+void GameRecord::clear() {
+    seed = 0;
+    lexiconId = 0;
+    gameMode = 0;
+    flags = 0;
+    moves.clear();
+}
+
+void GameRecord::appendTo(std::vector<uint8_t>& out) const {
+    out.reserve(out.size() + HEADER_BYTES + moves.size() * MOVE_BYTES);
+
+    putU32(out, FILE_MAGIC);
+    putU16(out, FILE_VERSION);
+    putU16(out, static_cast<uint16_t>(HEADER_BYTES));
+    putU32(out, seed);
+    putU32(out, static_cast<uint32_t>(moves.size()));
+    putU64(out, lexiconId);
+    out.push_back(gameMode);
+    out.push_back(flags);
+    out.insert(out.end(), 6, 0);
+
+    for (const RecordedMove& move : moves) {
+        out.push_back(static_cast<uint8_t>(move.type));
+        out.push_back(move.player);
+        out.push_back(move.tileCount);
+        out.push_back(move.blankMask);
+        putU16(out, static_cast<uint16_t>(move.score));
+        out.insert(out.end(), move.squares, move.squares + RecordedMove::MAX_TILES);
+        out.insert(out.end(), move.letters, move.letters + RecordedMove::MAX_TILES);
+        out.insert(out.end(), 4, 0);
+    }
+}
+
+bool GameRecord::parse(const uint8_t* data, size_t size, size_t& offset, GameRecord& record) {
+    if (offset > size || size - offset < HEADER_BYTES) return false;
+
+    const uint8_t* header = data + offset;
+    if (getU32(header) != FILE_MAGIC || getU16(header + 4) != FILE_VERSION) return false;
+
+    // A later version may grow the header; moves start after whatever it declares
+    const size_t headerBytes = getU16(header + 6);
+    const uint32_t moveCount = getU32(header + 12);
+    if (headerBytes < HEADER_BYTES || size - offset < headerBytes ||
+        (size - offset - headerBytes) / MOVE_BYTES < moveCount) {
+        return false;
+    }
+
+    record.seed = getU32(header + 8);
+    record.lexiconId = getU64(header + 16);
+    record.gameMode = header[24];
+    record.flags = header[25];
+    record.moves.resize(moveCount);
+
+    const uint8_t* entry = header + headerBytes;
+    for (RecordedMove& move : record.moves) {
+        // Validated here so every reader can index a parsed record directly
+        if (entry[0] > static_cast<uint8_t>(RecordedMoveType::GAME_END) || entry[1] > 1 ||
+            entry[2] > RecordedMove::MAX_TILES) {
+            return false;
+        }
+        move.type = static_cast<RecordedMoveType>(entry[0]);
+        move.player = entry[1];
+        move.tileCount = entry[2];
+        move.blankMask = entry[3];
+        move.score = static_cast<int16_t>(getU16(entry + 4));
+        for (int i = 0; i < RecordedMove::MAX_TILES; ++i) {
+            move.squares[i] = entry[6 + i];
+            move.letters[i] = static_cast<char>(entry[13 + i]);
+            if (i < move.tileCount && move.squares[i] >= BOARD_SQUARES) return false;
+        }
+        entry += MOVE_BYTES;
+    }
+
+    offset += headerBytes + moveCount * MOVE_BYTES;
+    return true;
+}
+
+bool GameRecord::appendToFile(const std::string& filename) const {
+    std::vector<uint8_t> bytes;
+    appendTo(bytes);
+
+    std::ofstream file(filename, std::ios::binary | std::ios::app);
+    if (!file.is_open()) {
+        LOG_ERROR("Error opening game record file: " << filename);
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!file) {
+        LOG_ERROR("Error writing game record file: " << filename);
+        return false;
+    }
+    return true;
+}
+
+bool GameRecord::readFile(const std::string& filename, std::vector<GameRecord>& records) {
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        LOG_ERROR("Error opening game record file: " << filename);
+        return false;
+    }
+
+    const std::streamsize size = file.tellg();
+    std::vector<uint8_t> bytes(static_cast<size_t>(size > 0 ? size : 0));
+    file.seekg(0, std::ios::beg);
+    if (!bytes.empty() && !file.read(reinterpret_cast<char*>(bytes.data()), size)) {
+        LOG_ERROR("Error reading game record file: " << filename);
+        return false;
+    }
+
+    size_t offset = 0;
+    while (offset < bytes.size()) {
+        GameRecord record;
+        if (!parse(bytes.data(), bytes.size(), offset, record)) {
+            LOG_ERROR("Corrupt game record at byte " << offset << " of " << filename);
+            return false;
+        }
+        records.push_back(std::move(record));
+    }
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class RecordedMoveType : uint8_t {
+    PLAY = 0,             // tiles placed and scored
+    PASS = 1,
+    INVALID_WORD = 2,     // a rejected word; counts towards the failure limit
+    BONUS = 3,            // end-of-game points (failure win, tiebreaker)
+    GAME_END = 4
+};
+
+struct RecordedMove {
+    static const int MAX_TILES = 7;
+
+    RecordedMoveType type;
+    uint8_t player;                 // 0 or 1
+    uint8_t tileCount;
+    uint8_t blankMask;              // bit i set when tile i is a blank
+    int16_t score;
+    uint8_t squares[MAX_TILES];     // row * 15 + col
+    char letters[MAX_TILES];
+};
+
+// One game as its tile-bag seed plus every move, enough to rebuild the board,
+// scores, racks and bag without the dictionary. On disk (little-endian):
+//   header, 32 bytes: magic "SCRB", u16 version, u16 header size, u32 seed,
+//                     u32 move count, u64 lexicon id, u8 game mode, u8 flags,
+//                     6 reserved
+//   moves, 24 bytes each: u8 type, u8 player, u8 tile count, u8 blank mask,
+//                     i16 score, 7 squares, 7 letters, 4 reserved
+// Records are self-delimiting, so a file may hold any number back to back.
+struct GameRecord {
+    static const uint32_t FILE_MAGIC = 0x42524353;   // "SCRB"
+    static const uint16_t FILE_VERSION = 1;
+    static const size_t HEADER_BYTES = 32;
+    static const size_t MOVE_BYTES = 24;
+
+    // The racks did not come from the seeded bag (e.g. an imported game), so
+    // a replay places the recorded tiles without drawing
+    static const uint8_t FLAG_EXTERNAL_RACKS = 1;
+
+    uint32_t seed;
+    uint64_t lexiconId;
+    uint8_t gameMode;
+    uint8_t flags;
+    std::vector<RecordedMove> moves;
+
+    GameRecord();
+
+    void clear();
+    void appendTo(std::vector<uint8_t>& out) const;
+
+    // Reads the record starting at `offset` and moves `offset` past it.
+    // Returns false on truncated or foreign data, leaving `offset` unchanged.
+    // A parsed move has a known type, player 0 or 1, at most MAX_TILES tiles
+    // and only on-board squares.
+    static bool parse(const uint8_t* data, size_t size, size_t& offset, GameRecord& record);
+
+    bool appendToFile(const std::string& filename) const;
+    static bool readFile(const std::string& filename, std::vector<GameRecord>& records);
+};
\ No newline at end of file
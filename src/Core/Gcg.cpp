@@ -0,0 +1,475 @@
+#include "Gcg.hpp"
+#include "Logger.hpp"
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+static const int BOARD_SIZE = 15;
+
+static void splitFields(const std::string& text, size_t begin, std::vector<std::string>& fields) {
+    fields.clear();
+    size_t pos = begin;
+    while (pos < text.size()) {
+        while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos]))) ++pos;
+        const size_t start = pos;
+        while (pos < text.size() && !std::isspace(static_cast<unsigned char>(text[pos]))) ++pos;
+        if (pos > start) fields.push_back(text.substr(start, pos - start));
+    }
+}
+
+static std::string trim(const std::string& text) {
+    size_t begin = 0;
+    size_t end = text.size();
+    while (begin < end && std::isspace(static_cast<unsigned char>(text[begin]))) ++begin;
+    while (end > begin && std::isspace(static_cast<unsigned char>(text[end - 1]))) --end;
+    return text.substr(begin, end - begin);
+}
+
+static bool parseNumber(const std::string& text, int& value) {
+    if (text.empty()) return false;
+    char* end = nullptr;
+    const long parsed = std::strtol(text.c_str(), &end, 10);
+    if (*end != '\0') return false;
+    value = static_cast<int>(parsed);
+    return true;
+}
+
+static bool isBlankLetter(char c) {
+    return c == '?' || std::islower(static_cast<unsigned char>(c));
+}
+
+GcgMove::GcgMove() : type(GcgMoveType::PASS), player(0), word(), score(0), total(0) {}
+
+void GcgGame::clear() {
+    for (int p = 0; p < 2; ++p) {
+        nicknames[p].clear();
+        names[p].clear();
+    }
+    lexicon.clear();
+    title.clear();
+    id.clear();
+    moves.clear();
+}
+
+bool GcgGame::toRecord(GameRecord& record) const {
+    record.clear();
+    record.flags = GameRecord::FLAG_EXTERNAL_RACKS;
+
+    for (const GcgMove& move : moves) {
+        if (move.player < 0 || move.player > 1) return false;
+
+        RecordedMove entry = {RecordedMoveType::BONUS, static_cast<uint8_t>(move.player), 0, 0,
+                              static_cast<int16_t>(move.score), {0}, {0}};
+        switch (move.type) {
+            case GcgMoveType::PLAY:
+                if (move.tiles.size() > RecordedMove::MAX_TILES ||
+                    move.tiles.size() != move.word.newTilePositions.size()) {
+                    return false;
+                }
+                entry.type = RecordedMoveType::PLAY;
+                for (size_t i = 0; i < move.tiles.size(); ++i) {
+                    const auto& pos = move.word.newTilePositions[i];
+                    const char letter = move.tiles[i];
+                    if (isBlankLetter(letter)) entry.blankMask |= 1 << i;
+                    entry.squares[i] = static_cast<uint8_t>(pos.first * BOARD_SIZE + pos.second);
+                    entry.letters[i] = letter == '?' ? ' ' : static_cast<char>(std::toupper(static_cast<unsigned char>(letter)));
+                }
+                entry.tileCount = static_cast<uint8_t>(move.tiles.size());
+                break;
+
+            case GcgMoveType::PASS:
+            case GcgMoveType::EXCHANGE:
+                entry.type = RecordedMoveType::PASS;
+                entry.score = 0;
+                break;
+
+            case GcgMoveType::WITHDRAWN:
+                // The phony never counted, so it becomes a rejected word
+                for (size_t i = record.moves.size(); i-- > 0;) {
+                    if (record.moves[i].type == RecordedMoveType::PLAY) {
+                        record.moves.erase(record.moves.begin() + i);
+                        break;
+                    }
+                }
+                entry.type = RecordedMoveType::INVALID_WORD;
+                entry.score = 0;
+                break;
+
+            default:
+                break;
+        }
+        record.moves.push_back(entry);
+    }
+
+    const uint8_t lastPlayer = record.moves.empty() ? 0 : record.moves.back().player;
+    record.moves.push_back({RecordedMoveType::GAME_END, lastPlayer, 0, 0, 0, {0}, {0}});
+    return true;
+}
+
+bool GcgGame::fromRecord(const GameRecord& record, GcgGame& game) {
+    game.clear();
+    game.nicknames[0] = "player1";
+    game.nicknames[1] = "player2";
+    game.names[0] = "Player 1";
+    game.names[1] = "Player 2";
+
+    char squares[BOARD_SIZE][BOARD_SIZE];
+    std::memset(squares, 0, sizeof(squares));
+    int totals[2] = {0, 0};
+
+    for (const RecordedMove& entry : record.moves) {
+        if (entry.player > 1 || entry.tileCount > RecordedMove::MAX_TILES) return false;
+
+        GcgMove move;
+        move.player = entry.player;
+        move.score = entry.score;
+        switch (entry.type) {
+            case RecordedMoveType::PLAY: {
+                if (entry.tileCount == 0) return false;
+                for (int i = 0; i < entry.tileCount; ++i) {
+                    if (entry.squares[i] >= BOARD_SIZE * BOARD_SIZE) return false;
+                    const bool blank = (entry.blankMask >> i) & 1;
+                    const char letter = entry.letters[i];
+                    char& square = squares[entry.squares[i] / BOARD_SIZE][entry.squares[i] % BOARD_SIZE];
+                    if (square) return false;
+                    square = !blank ? letter
+                           : letter == ' ' ? '?' : static_cast<char>(std::tolower(static_cast<unsigned char>(letter)));
+                }
+
+                const int row = entry.squares[0] / BOARD_SIZE;
+                const int col = entry.squares[0] % BOARD_SIZE;
+                auto occupied = [&](int r, int c) {
+                    return r >= 0 && r < BOARD_SIZE && c >= 0 && c < BOARD_SIZE && squares[r][c] != 0;
+                };
+
+                // A single tile reads along whichever line it extends
+                bool horizontal = entry.tileCount > 1
+                    ? entry.squares[1] / BOARD_SIZE == row
+                    : occupied(row, col - 1) || occupied(row, col + 1) || !(occupied(row - 1, col) || occupied(row + 1, col));
+                const int dr = horizontal ? 0 : 1;
+                const int dc = horizontal ? 1 : 0;
+
+                int r = row;
+                int c = col;
+                while (occupied(r - dr, c - dc)) {
+                    r -= dr;
+                    c -= dc;
+                }
+                move.type = GcgMoveType::PLAY;
+                move.word.startRow = r;
+                move.word.startCol = c;
+                move.word.isHorizontal = horizontal;
+                for (; occupied(r, c); r += dr, c += dc) {
+                    const char letter = squares[r][c];
+                    move.word.word.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(letter))));
+                    move.word.positions.emplace_back(r, c);
+                    for (int i = 0; i < entry.tileCount; ++i) {
+                        if (entry.squares[i] == r * BOARD_SIZE + c) {
+                            move.word.newTilePositions.emplace_back(r, c);
+                            move.tiles.push_back(letter);
+                        }
+                    }
+                }
+                if (move.tiles.size() != entry.tileCount) return false;
+                break;
+            }
+
+            case RecordedMoveType::PASS:
+                move.type = GcgMoveType::PASS;
+                move.score = 0;
+                break;
+
+            case RecordedMoveType::BONUS:
+                move.type = GcgMoveType::END_RACK_POINTS;
+                break;
+
+            // Rejected words never reached the board and have no GCG form
+            case RecordedMoveType::INVALID_WORD:
+            case RecordedMoveType::GAME_END:
+                continue;
+
+            default:
+                return false;
+        }
+
+        totals[move.player] += move.score;
+        move.total = totals[move.player];
+        game.moves.push_back(std::move(move));
+    }
+    return true;
+}
+
+GcgReader::GcgReader(std::istream& input)
+    : input(input), hasPendingLine(false), lineNumber(0), skippedGames(0), lastPlay(-1) {
+    std::memset(squares, 0, sizeof(squares));
+}
+
+bool GcgReader::readLine() {
+    if (hasPendingLine) {
+        hasPendingLine = false;
+        return true;
+    }
+    if (!std::getline(input, line)) return false;
+    ++lineNumber;
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    return true;
+}
+
+bool GcgReader::fail(const char* reason) {
+    LOG_WARN("GCG line " << lineNumber << ": " << reason << ": " << line);
+    return false;
+}
+
+bool GcgReader::readGame(GcgGame& game) {
+    for (;;) {
+        game.clear();
+        std::memset(squares, 0, sizeof(squares));
+        lastPlay = -1;
+
+        bool started = false;
+        bool valid = true;
+        size_t moveLines = 0;
+        while (readLine()) {
+            if (line.empty()) continue;
+
+            if (line[0] == '#') {
+                // A fresh header after moves opens the next game
+                if (moveLines > 0 && (line.compare(0, 8, "#player1") == 0 ||
+                                      line.compare(0, 19, "#character-encoding") == 0)) {
+                    hasPendingLine = true;
+                    break;
+                }
+                started = true;
+                if (valid) parsePragma(game);
+            } else if (line[0] == '>') {
+                started = true;
+                ++moveLines;
+                if (valid && !parseMove(game)) valid = false;
+            }
+            // Anything else is free text
+        }
+
+        if (!started) return false;
+        if (valid) return true;
+        ++skippedGames;
+    }
+}
+
+void GcgReader::parsePragma(GcgGame& game) {
+    size_t keyEnd = 1;
+    while (keyEnd < line.size() && !std::isspace(static_cast<unsigned char>(line[keyEnd]))) ++keyEnd;
+    const std::string key = line.substr(1, keyEnd - 1);
+    const std::string value = trim(line.substr(keyEnd));
+
+    if (key == "player1" || key == "player2") {
+        const int p = key[6] - '1';
+        const size_t split = value.find_first_of(" \t");
+        game.nicknames[p] = value.substr(0, split);
+        game.names[p] = split == std::string::npos ? game.nicknames[p] : trim(value.substr(split));
+    } else if (key == "lexicon") {
+        game.lexicon = value;
+    } else if (key == "title") {
+        game.title = value;
+    } else if (key == "id") {
+        game.id = value;
+    } else if (key == "note" && !game.moves.empty()) {
+        std::string& note = game.moves.back().note;
+        if (!note.empty()) note.push_back('\n');
+        note += value;
+    }
+}
+
+int GcgReader::findPlayer(GcgGame& game, const std::string& nickname) {
+    for (int p = 0; p < 2; ++p) {
+        if (game.nicknames[p] == nickname) return p;
+    }
+    // Files without player pragmas name the players as they move
+    for (int p = 0; p < 2; ++p) {
+        if (game.nicknames[p].empty()) {
+            game.nicknames[p] = nickname;
+            game.names[p] = nickname;
+            return p;
+        }
+    }
+    return -1;
+}
+
+bool GcgReader::parseMove(GcgGame& game) {
+    const size_t colon = line.find(':');
+    if (colon == std::string::npos) return fail("Missing ':' after the player");
+
+    GcgMove move;
+    move.player = findPlayer(game, trim(line.substr(1, colon - 1)));
+    if (move.player < 0) return fail("Unknown player");
+
+    // The last two fields are always the score and the running total; the
+    // rack in front is optional
+    std::vector<std::string> fields;
+    splitFields(line, colon + 1, fields);
+    if (fields.size() < 3 || !parseNumber(fields[fields.size() - 2], move.score) ||
+        !parseNumber(fields.back(), move.total)) {
+        return fail("Malformed score");
+    }
+    fields.resize(fields.size() - 2);
+
+    const bool hasPosition = fields.size() >= 2 &&
+        fields[fields.size() - 2].find_first_of("0123456789") != std::string::npos;
+    if (hasPosition) {
+        if (fields.size() > 3) return fail("Too many fields");
+        if (fields.size() == 3) move.rack = fields[0];
+        move.type = GcgMoveType::PLAY;
+        if (!parsePlay(move, fields[fields.size() - 2], fields.back())) return false;
+        lastPlay = static_cast<int>(game.moves.size());
+        game.moves.push_back(std::move(move));
+        return true;
+    }
+
+    if (fields.size() > 2) return fail("Too many fields");
+    const std::string& action = fields.back();
+    if (fields.size() == 2) move.rack = fields[0];
+
+    if (action == "-") {
+        move.type = GcgMoveType::PASS;
+    } else if (action == "--") {
+        move.type = GcgMoveType::WITHDRAWN;
+        if (!withdrawLastPlay(game, move.player)) return false;
+    } else if (action[0] == '-') {
+        move.type = GcgMoveType::EXCHANGE;
+        move.tiles = action.substr(1);
+    } else if (action == "(challenge)") {
+        move.type = GcgMoveType::CHALLENGE_BONUS;
+    } else if (action == "(time)") {
+        move.type = GcgMoveType::TIME_PENALTY;
+    } else if (action.size() >= 2 && action.front() == '(' && action.back() == ')') {
+        // "(RACK)" alone scores the opponent's tiles; after a rack it is a penalty
+        move.type = fields.size() == 2 ? GcgMoveType::END_RACK_PENALTY : GcgMoveType::END_RACK_POINTS;
+        move.tiles = action.substr(1, action.size() - 2);
+    } else {
+        return fail("Unknown move");
+    }
+    game.moves.push_back(std::move(move));
+    return true;
+}
+
+bool GcgReader::parsePlay(GcgMove& move, const std::string& position, const std::string& letters) {
+    // "8D" runs across row 8 from column D; "D8" runs down column D
+    const bool horizontal = std::isdigit(static_cast<unsigned char>(position[0])) != 0;
+    const size_t letterAt = horizontal ? position.size() - 1 : 0;
+    const char columnLetter = static_cast<char>(std::toupper(static_cast<unsigned char>(position[letterAt])));
+    int row = 0;
+    if (position.size() < 2 || position.size() > 3 ||
+        !parseNumber(horizontal ? position.substr(0, letterAt) : position.substr(1), row) ||
+        row < 1 || row > BOARD_SIZE || columnLetter < 'A' || columnLetter >= 'A' + BOARD_SIZE) {
+        return fail("Bad position");
+    }
+
+    WordInfo& word = move.word;
+    word.startRow = row - 1;
+    word.startCol = columnLetter - 'A';
+    word.isHorizontal = horizontal;
+
+    for (size_t i = 0; i < letters.size(); ++i) {
+        const int r = word.startRow + (horizontal ? 0 : static_cast<int>(i));
+        const int c = word.startCol + (horizontal ? static_cast<int>(i) : 0);
+        if (r >= BOARD_SIZE || c >= BOARD_SIZE) return fail("Word runs off the board");
+
+        const char letter = letters[i];
+        char& square = squares[r][c];
+        word.positions.emplace_back(r, c);
+
+        if (letter == '.' || (square && std::toupper(static_cast<unsigned char>(square)) ==
+                                        std::toupper(static_cast<unsigned char>(letter)))) {
+            // Some writers spell out the tiles a word plays through
+            if (!square) return fail("Plays through an empty square");
+        } else if (std::isalpha(static_cast<unsigned char>(letter)) || letter == '?') {
+            if (square) return fail("Square already taken");
+            square = letter;
+            word.newTilePositions.emplace_back(r, c);
+            move.tiles.push_back(letter);
+        } else {
+            return fail("Bad letter in word");
+        }
+        word.word.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(square))));
+    }
+
+    if (word.newTilePositions.empty()) return fail("Play places no tiles");
+    return true;
+}
+
+bool GcgReader::withdrawLastPlay(GcgGame& game, int player) {
+    if (lastPlay < 0) return fail("Nothing to withdraw");
+    if (game.moves[lastPlay].player != player) return fail("Withdrawal by a different player");
+
+    for (const auto& pos : game.moves[lastPlay].word.newTilePositions) {
+        squares[pos.first][pos.second] = 0;
+    }
+    lastPlay = -1;
+    return true;
+}
+
+size_t GcgReader::getLineNumber() const {
+    return lineNumber;
+}
+
+size_t GcgReader::getSkippedGames() const {
+    return skippedGames;
+}
+
+GcgWriter::GcgWriter(std::ostream& output) : output(output) {}
+
+std::string GcgWriter::formatPosition(const WordInfo& word) {
+    const std::string row = std::to_string(word.startRow + 1);
+    const char column = static_cast<char>('A' + word.startCol);
+    return word.isHorizontal ? row + column : column + row;
+}
+
+bool GcgWriter::writeGame(const GcgGame& game) {
+    output << "#character-encoding UTF-8\n";
+    for (int p = 0; p < 2; ++p) {
+        if (game.nicknames[p].empty()) continue;
+        output << "#player" << (p + 1) << ' ' << game.nicknames[p] << ' '
+               << (game.names[p].empty() ? game.nicknames[p] : game.names[p]) << '\n';
+    }
+    if (!game.title.empty()) output << "#title " << game.title << '\n';
+    if (!game.lexicon.empty()) output << "#lexicon " << game.lexicon << '\n';
+    if (!game.id.empty()) output << "#id " << game.id << '\n';
+
+    for (const GcgMove& move : game.moves) {
+        if (move.player < 0 || move.player > 1) return false;
+
+        output << '>' << game.nicknames[move.player] << ':';
+        if (!move.rack.empty()) output << ' ' << move.rack;
+
+        switch (move.type) {
+            case GcgMoveType::PLAY: {
+                output << ' ' << formatPosition(move.word) << ' ';
+                size_t next = 0;
+                for (const auto& pos : move.word.positions) {
+                    const bool placed = next < move.word.newTilePositions.size() &&
+                                        move.word.newTilePositions[next] == pos;
+                    output << (placed ? move.tiles[next++] : '.');
+                }
+                break;
+            }
+            case GcgMoveType::PASS:            output << " -"; break;
+            case GcgMoveType::EXCHANGE:        output << " -" << move.tiles; break;
+            case GcgMoveType::WITHDRAWN:       output << " --"; break;
+            case GcgMoveType::CHALLENGE_BONUS: output << " (challenge)"; break;
+            case GcgMoveType::TIME_PENALTY:    output << " (time)"; break;
+            case GcgMoveType::END_RACK_POINTS:
+            case GcgMoveType::END_RACK_PENALTY:
+                output << " (" << move.tiles << ')';
+                break;
+        }
+        output << ' ' << (move.score >= 0 ? "+" : "") << move.score << ' ' << move.total << '\n';
+
+        size_t start = 0;
+        while (start < move.note.size()) {
+            size_t end = move.note.find('\n', start);
+            if (end == std::string::npos) end = move.note.size();
+            output << "#note " << move.note.substr(start, end - start) << '\n';
+            start = end + 1;
+        }
+    }
+    return static_cast<bool>(output);
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+#include "Board.hpp"
+#include "GameRecord.hpp"
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// GCG, the plain-text game notation used by annotators and analysis tools:
+//   #player1 nick Full Name
+//   >nick: RACK 8D WORD +score total      horizontal play at row 8, column D
+//   >nick: RACK D8 WORD +score total      vertical play
+// A '.' in WORD is a tile already on the board and a lowercase letter is a
+// blank. Rows and columns map to the board's 0-based (row, col).
+enum class GcgMoveType {
+    PLAY,
+    PASS,
+    EXCHANGE,
+    WITHDRAWN,          // "--": the previous play came off the board
+    CHALLENGE_BONUS,
+    END_RACK_POINTS,    // "(RACK)": the opponent's leftover tiles
+    END_RACK_PENALTY,   // "RACK (RACK)": own leftover tiles
+    TIME_PENALTY
+};
+
+struct GcgMove {
+    GcgMoveType type;
+    int player;                   // 0 or 1
+    std::string rack;             // '?' is a blank
+    WordInfo word;                // PLAY: the whole word, through-tiles included
+    std::string tiles;            // PLAY: letters of newTilePositions, lowercase for blanks;
+                                  // EXCHANGE: the exchanged tiles; END_RACK_*: the counted rack
+    int score;
+    int total;
+    std::string note;
+
+    GcgMove();
+};
+
+struct GcgGame {
+    std::string nicknames[2];
+    std::string names[2];
+    std::string lexicon;
+    std::string title;
+    std::string id;
+    std::vector<GcgMove> moves;
+
+    void clear();
+
+    // Imported racks are not from the seeded bag, so the record is flagged
+    // FLAG_EXTERNAL_RACKS. Withdrawn plays become rejected words.
+    bool toRecord(GameRecord& record) const;
+
+    // Racks are not stored in a record; each move lists the tiles it played.
+    static bool fromRecord(const GameRecord& record, GcgGame& game);
+};
+
+// Reads one game at a time from a stream, so an archive of any size never
+// has to fit in memory. A "#player1" line after moves starts the next game.
+class GcgReader {
+private:
+    static const int BOARD_SIZE = 15;
+
+    std::istream& input;
+    std::string line;
+    bool hasPendingLine;
+    size_t lineNumber;
+    size_t skippedGames;
+    char squares[BOARD_SIZE][BOARD_SIZE];
+    int lastPlay;
+
+    bool readLine();
+    void parsePragma(GcgGame& game);
+    bool parseMove(GcgGame& game);
+    bool parsePlay(GcgMove& move, const std::string& position, const std::string& letters);
+    bool fail(const char* reason);
+    bool withdrawLastPlay(GcgGame& game, int player);
+    static int findPlayer(GcgGame& game, const std::string& nickname);
+
+public:
+    explicit GcgReader(std::istream& input);
+
+    // Returns false once the stream is exhausted. A malformed game is
+    // reported, skipped and counted rather than ending the archive.
+    bool readGame(GcgGame& game);
+
+    size_t getLineNumber() const;
+    size_t getSkippedGames() const;
+};
+
+class GcgWriter {
+private:
+    std::ostream& output;
+
+public:
+    explicit GcgWriter(std::ostream& output);
+
+    bool writeGame(const GcgGame& game);
+
+    static std::string formatPosition(const WordInfo& word);
+};
\ No newline at end of file
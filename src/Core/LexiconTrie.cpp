@@ -0,0 +1,296 @@
+#include "LexiconTrie.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+using namespace std;
+
+static const uint32_t ALL_LETTERS = (1u << 26) - 1;
+
+WordPattern::WordPattern() : runTokens(0), minLength(0), maxLength(SIZE_MAX) {}
+
+bool WordPattern::parse(const std::string& text, WordPattern& pattern) {
+    pattern.letterMasks.clear();
+    pattern.runTokens = 0;
+
+    for (size_t i = 0; i < text.size(); ++i) {
+        char c = static_cast<char>(toupper(static_cast<unsigned char>(text[i])));
+        uint32_t mask = 0;
+
+        if (c == '*') {
+            // "**" is the same run as "*"
+            if (!pattern.letterMasks.empty() &&
+                (pattern.runTokens >> (pattern.letterMasks.size() - 1)) & 1) {
+                continue;
+            }
+            pattern.runTokens |= 1ULL << pattern.letterMasks.size();
+            mask = ALL_LETTERS;
+        } else if (c == '?') {
+            mask = ALL_LETTERS;
+        } else if (c >= 'A' && c <= 'Z') {
+            mask = 1u << (c - 'A');
+        } else if (c == '[') {
+            size_t close = text.find(']', i + 1);
+            if (close == string::npos) {
+                LOG_ERROR("Unterminated letter set in pattern: " << text);
+                return false;
+            }
+            bool negate = close > i + 1 && text[i + 1] == '^';
+            for (size_t j = i + 1 + (negate ? 1 : 0); j < close; ++j) {
+                char letter = static_cast<char>(toupper(static_cast<unsigned char>(text[j])));
+                if (letter < 'A' || letter > 'Z') {
+                    LOG_ERROR("Invalid letter in pattern set: " << text);
+                    return false;
+                }
+                mask |= 1u << (letter - 'A');
+            }
+            // "[^]" lists no letters to exclude, so it is as empty as "[]"
+            if (negate && mask != 0) mask = ~mask & ALL_LETTERS;
+            if (mask == 0) {
+                LOG_ERROR("Empty letter set in pattern: " << text);
+                return false;
+            }
+            i = close;
+        } else {
+            LOG_ERROR("Invalid character in pattern: " << text);
+            return false;
+        }
+
+        if (pattern.letterMasks.size() >= MAX_TOKENS) {
+            LOG_ERROR("Pattern too long: " << text);
+            return false;
+        }
+        pattern.letterMasks.push_back(mask);
+    }
+    return true;
+}
+
+struct LexiconTrie::MatchContext {
+    const WordPattern* pattern;
+    uint64_t acceptState;
+    vector<uint8_t> minRemaining;   // letters still required from token t
+    vector<uint8_t> openEnded;      // a run follows token t, so any length fits
+    string word;
+    vector<string>* results;
+    size_t maxResults;
+    size_t added;
+
+    uint64_t closure(uint64_t states) const {
+        // A run may match nothing, so reaching it also reaches the next token
+        for (size_t t = 0; t < pattern->letterMasks.size(); ++t) {
+            if (((states >> t) & 1) && ((pattern->runTokens >> t) & 1)) {
+                states |= 1ULL << (t + 1);
+            }
+        }
+        return states;
+    }
+
+    uint64_t step(uint64_t states, int letter) const {
+        uint64_t next = 0;
+        for (size_t t = 0; t < pattern->letterMasks.size(); ++t) {
+            if (!((states >> t) & 1) || !((pattern->letterMasks[t] >> letter) & 1)) continue;
+            next |= ((pattern->runTokens >> t) & 1) ? (1ULL << t) : (1ULL << (t + 1));
+        }
+        return closure(next);
+    }
+};
+
+LexiconTrie::LexiconTrie() {}
+
+void LexiconTrie::build(std::vector<std::string_view> words) {
+    clear();
+    nodes.push_back(Node{0, 0, 0, 0, 0});
+    nodes.reserve(words.size() * 3);
+
+    vector<string_view> scratch(words.size());
+    buildRange(0, words, scratch, 0, words.size(), 0);
+    nodes.shrink_to_fit();
+}
+
+uint8_t LexiconTrie::buildRange(uint32_t nodeIndex, std::vector<std::string_view>& words,
+                                std::vector<std::string_view>& scratch, size_t begin, size_t end,
+                                size_t depth) {
+    // A single word left: the rest of the branch is a plain chain
+    if (end - begin == 1) {
+        const string_view word = words[begin];
+        uint32_t current = nodeIndex;
+        for (size_t d = depth; d < word.size(); ++d) {
+            const uint32_t child = static_cast<uint32_t>(nodes.size());
+            nodes.push_back(Node{0, 0, word[d], 0, static_cast<uint8_t>(std::min<size_t>(word.size() - d - 1, 255))});
+            nodes[current].firstChild = child;
+            nodes[current].childCount = 1;
+            current = child;
+        }
+        nodes[current].terminal = 1;
+        nodes[nodeIndex].height = static_cast<uint8_t>(std::min<size_t>(word.size() - depth, 255));
+        return nodes[nodeIndex].height;
+    }
+
+    // Bucket the range by the letter at `depth` (bucket 0: the word ends here).
+    // This is one pass of an MSD radix sort, so the input never needs sorting.
+    size_t counts[27] = {0};
+    for (size_t i = begin; i < end; ++i) {
+        ++counts[words[i].size() == depth ? 0 : words[i][depth] - 'A' + 1];
+    }
+
+    size_t offsets[28];
+    offsets[0] = begin;
+    size_t childCount = 0;
+    for (int b = 0; b < 27; ++b) {
+        offsets[b + 1] = offsets[b] + counts[b];
+        if (b > 0 && counts[b] > 0) ++childCount;
+    }
+
+    size_t fill[27];
+    std::copy(offsets, offsets + 27, fill);
+    for (size_t i = begin; i < end; ++i) {
+        scratch[fill[words[i].size() == depth ? 0 : words[i][depth] - 'A' + 1]++] = words[i];
+    }
+    std::copy(scratch.begin() + begin, scratch.begin() + end, words.begin() + begin);
+
+    const uint32_t firstChild = static_cast<uint32_t>(nodes.size());
+    nodes.resize(nodes.size() + childCount);
+    nodes[nodeIndex].terminal = counts[0] > 0 ? 1 : 0;
+    nodes[nodeIndex].firstChild = firstChild;
+    nodes[nodeIndex].childCount = static_cast<uint8_t>(childCount);
+
+    size_t height = 0;
+    uint32_t childIndex = firstChild;
+    for (int b = 1; b < 27; ++b) {
+        if (counts[b] == 0) continue;
+
+        nodes[childIndex] = Node{0, 0, static_cast<char>('A' + b - 1), 0, 0};
+        uint8_t childHeight = buildRange(childIndex, words, scratch, offsets[b], offsets[b + 1], depth + 1);
+        height = std::max<size_t>(height, childHeight + 1u);
+        ++childIndex;
+    }
+
+    nodes[nodeIndex].height = static_cast<uint8_t>(std::min<size_t>(height, 255));
+    return nodes[nodeIndex].height;
+}
+
+void LexiconTrie::clear() {
+    nodes.clear();
+    nodes.shrink_to_fit();
+}
+
+uint32_t LexiconTrie::findPrefix(const std::string& prefix) const {
+    uint32_t current = 0;
+    for (char c : prefix) {
+        const Node& node = nodes[current];
+        const Node* first = nodes.data() + node.firstChild;
+        const Node* last = first + node.childCount;
+        const Node* found = std::lower_bound(first, last, c, [](const Node& n, char letter) {
+            return n.letter < letter;
+        });
+        if (found == last || found->letter != c) return UINT32_MAX;
+        current = static_cast<uint32_t>(found - nodes.data());
+    }
+    return current;
+}
+
+void LexiconTrie::matchNode(uint32_t nodeIndex, uint64_t states, MatchContext& context) const {
+    const Node& node = nodes[nodeIndex];
+    const size_t depth = context.word.size();
+    const WordPattern& pattern = *context.pattern;
+
+    // Prune on the cheapest bound the live token states allow
+    size_t minNeeded = SIZE_MAX;
+    bool openEnded = false;
+    size_t maxNeeded = 0;
+    for (size_t t = 0; t <= pattern.letterMasks.size(); ++t) {
+        if (!((states >> t) & 1)) continue;
+        minNeeded = std::min<size_t>(minNeeded, context.minRemaining[t]);
+        maxNeeded = std::max<size_t>(maxNeeded, context.minRemaining[t]);
+        openEnded = openEnded || context.openEnded[t];
+    }
+    if (minNeeded > node.height || depth + minNeeded > pattern.maxLength) return;
+    if (depth + node.height < pattern.minLength) return;
+    if (!openEnded && depth + maxNeeded < pattern.minLength) return;
+
+    if (node.terminal && (states & context.acceptState) &&
+        depth >= pattern.minLength && depth <= pattern.maxLength) {
+        context.results->push_back(context.word);
+        if (++context.added >= context.maxResults) return;
+    }
+
+    for (uint32_t i = 0; i < node.childCount; ++i) {
+        const uint32_t childIndex = node.firstChild + i;
+        const char letter = nodes[childIndex].letter;
+        uint64_t next = context.step(states, letter - 'A');
+        if (!next) continue;
+
+        context.word.push_back(letter);
+        matchNode(childIndex, next, context);
+        context.word.pop_back();
+        if (context.added >= context.maxResults) return;
+    }
+}
+
+size_t LexiconTrie::match(const WordPattern& pattern, std::vector<std::string>& results,
+                          size_t maxResults) const {
+    if (nodes.empty() || maxResults == 0 || pattern.minLength > pattern.maxLength) return 0;
+
+    const size_t tokenCount = pattern.letterMasks.size();
+    MatchContext context;
+    context.pattern = &pattern;
+    context.acceptState = 1ULL << tokenCount;
+    context.minRemaining.assign(tokenCount + 1, 0);
+    context.openEnded.assign(tokenCount + 1, 0);
+    for (size_t t = tokenCount; t-- > 0;) {
+        const bool run = (pattern.runTokens >> t) & 1;
+        context.minRemaining[t] = static_cast<uint8_t>(context.minRemaining[t + 1] + (run ? 0 : 1));
+        context.openEnded[t] = run || context.openEnded[t + 1];
+    }
+    context.results = &results;
+    context.maxResults = maxResults;
+    context.added = 0;
+
+    matchNode(0, context.closure(1), context);
+    return context.added;
+}
+
+size_t LexiconTrie::complete(const std::string& prefix, std::vector<std::string>& results,
+                             size_t maxResults) const {
+    if (nodes.empty() || maxResults == 0) return 0;
+
+    uint32_t start = findPrefix(prefix);
+    if (start == UINT32_MAX) return 0;
+
+    // Breadth-first: each level is one letter longer and stays in alphabetical order
+    size_t added = 0;
+    vector<pair<uint32_t, string>> level = {{start, prefix}};
+    vector<pair<uint32_t, string>> nextLevel;
+
+    while (!level.empty()) {
+        for (const auto& entry : level) {
+            if (nodes[entry.first].terminal) {
+                results.push_back(entry.second);
+                if (++added >= maxResults) return added;
+            }
+        }
+
+        nextLevel.clear();
+        for (const auto& entry : level) {
+            const Node& node = nodes[entry.first];
+            for (uint32_t i = 0; i < node.childCount; ++i) {
+                nextLevel.emplace_back(node.firstChild + i, entry.second + nodes[node.firstChild + i].letter);
+            }
+        }
+        level.swap(nextLevel);
+    }
+    return added;
+}
+
+bool LexiconTrie::isEmpty() const {
+    return nodes.size() <= 1;
+}
+
+size_t LexiconTrie::getNodeCount() const {
+    return nodes.size();
+}
+
+size_t LexiconTrie::getSizeBytes() const {
+    return nodes.size() * sizeof(Node);
+}
\ No newline at end of file
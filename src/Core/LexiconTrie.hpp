@@ -0,0 +1,72 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Compiled form of a query such as "Q?I?", "*X*" or "[AEIOU]??S".
+//   A-Z    that letter
+//   ?      any single letter
+//   [ABC]  one letter from the set ([^ABC] excludes the set)
+//   *      any run of letters, possibly empty
+struct WordPattern {
+    static const size_t MAX_TOKENS = 63;
+
+    std::vector<uint32_t> letterMasks;   // bit (c - 'A') set when token accepts c
+    uint64_t runTokens;                  // bit t set when token t is a '*' run
+    size_t minLength;
+    size_t maxLength;
+
+    WordPattern();
+
+    static bool parse(const std::string& text, WordPattern& pattern);
+};
+
+// Read-only trie over the word list. Every node's children sit next to each
+// other in one array, so a traversal only follows indices.
+class LexiconTrie {
+private:
+    struct Node {
+        uint32_t firstChild;
+        uint8_t childCount;
+        char letter;
+        uint8_t terminal;
+        uint8_t height;       // longest path below this node
+    };
+
+    std::vector<Node> nodes;
+
+    uint8_t buildRange(uint32_t nodeIndex, std::vector<std::string_view>& words,
+                       std::vector<std::string_view>& scratch, size_t begin, size_t end, size_t depth);
+    uint32_t findPrefix(const std::string& prefix) const;
+
+    struct MatchContext;
+    void matchNode(uint32_t nodeIndex, uint64_t states, MatchContext& context) const;
+
+public:
+    LexiconTrie();
+
+    // Words must be unique and uppercase A-Z, in any order; the views are
+    // only read during the call.
+    void build(std::vector<std::string_view> words);
+    void clear();
+
+    // Appends at most `maxResults` words in alphabetical order; returns the number added.
+    size_t match(const WordPattern& pattern, std::vector<std::string>& results, size_t maxResults) const;
+
+    // Shortest completions of `prefix` first, then alphabetical.
+    size_t complete(const std::string& prefix, std::vector<std::string>& results, size_t maxResults) const;
+
+    // Read-only walking for searches the queries above do not cover. Node
+    // ROOT is the empty prefix; a node's children are consecutive, in
+    // alphabetical order. Only valid while the trie is not empty.
+    static const uint32_t ROOT = 0;
+    uint32_t getFirstChild(uint32_t node) const { return nodes[node].firstChild; }
+    uint32_t getChildCount(uint32_t node) const { return nodes[node].childCount; }
+    char getLetter(uint32_t node) const { return nodes[node].letter; }
+    bool isTerminal(uint32_t node) const { return nodes[node].terminal != 0; }
+
+    bool isEmpty() const;
+    size_t getNodeCount() const;
+    size_t getSizeBytes() const;
+};
\ No newline at end of file
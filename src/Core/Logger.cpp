@@ -0,0 +1,117 @@
+#include "Logger.hpp"
+#include <algorithm>
+#include <cstdio>
+
+Logger::Logger()
+    : ring(RING_SIZE), head(0), tail(0), written(0), dropped(0), stopping(false),
+      minLevel(std::max(SCRABBLE_LOG_LEVEL, static_cast<int>(LogLevel::DEBUG))),
+      startTime(std::chrono::steady_clock::now()) {
+    writer = std::thread(&Logger::writerLoop, this);
+}
+
+Logger::~Logger() {
+    shutdown();
+}
+
+Logger& Logger::instance() {
+    static Logger logger;
+    return logger;
+}
+
+const char* Logger::levelName(LogLevel level) {
+    switch (level) {
+        case LogLevel::TRACE: return "TRACE";
+        case LogLevel::DEBUG: return "DEBUG";
+        case LogLevel::INFO: return "INFO";
+        case LogLevel::WARN: return "WARN";
+        case LogLevel::ERR: return "ERROR";
+    }
+    return "?";
+}
+
+void Logger::setLevel(LogLevel level) {
+    minLevel.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+LogLevel Logger::getLevel() const {
+    return static_cast<LogLevel>(minLevel.load(std::memory_order_relaxed));
+}
+
+void Logger::write(LogLevel level, std::string text) {
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stopping || head - tail >= RING_SIZE) {
+            ++dropped;
+            return;
+        }
+        Record& record = ring[head % RING_SIZE];
+        record.level = level;
+        record.seconds = seconds;
+        record.text.swap(text);
+        ++head;
+    }
+    pending.notify_one();
+}
+
+void Logger::writerLoop() {
+    std::vector<Record> batch;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        pending.wait(lock, [this] { return stopping || tail != head; });
+        if (tail == head && stopping) break;
+
+        // Take everything queued, then write it without holding the lock
+        batch.clear();
+        while (tail != head) {
+            Record& record = ring[tail % RING_SIZE];
+            batch.push_back({record.level, record.seconds, std::string()});
+            batch.back().text.swap(record.text);
+            ++tail;
+        }
+        const uint64_t batchEnd = tail;
+        lock.unlock();
+
+        bool wroteErrors = false;
+        for (const Record& record : batch) {
+            // Warnings and errors go to stderr like the std::cerr calls they replace
+            FILE* stream = record.level >= LogLevel::WARN ? stderr : stdout;
+            std::fprintf(stream, "[%9.3f] %-5s %s\n", record.seconds, levelName(record.level), record.text.c_str());
+            wroteErrors = wroteErrors || stream == stderr;
+        }
+        std::fflush(stdout);
+        if (wroteErrors) std::fflush(stderr);
+
+        lock.lock();
+        written = batchEnd;
+        drained.notify_all();
+    }
+}
+
+void Logger::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    const uint64_t target = head;
+    drained.wait(lock, [this, target] { return written >= target || !writer.joinable(); });
+}
+
+void Logger::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stopping) return;
+        stopping = true;
+    }
+    pending.notify_one();
+    if (writer.joinable()) {
+        writer.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (dropped > 0) {
+        std::fprintf(stderr, "Logger dropped %llu messages\n", static_cast<unsigned long long>(dropped));
+    }
+}
+
+uint64_t Logger::getDroppedCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return dropped;
+}
\ No newline at end of file
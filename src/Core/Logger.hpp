@@ -0,0 +1,116 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ERR rather than ERROR: <wingdi.h> defines ERROR as a macro
+enum class LogLevel : int {
+    TRACE = 0,
+    DEBUG = 1,
+    INFO = 2,
+    WARN = 3,
+    ERR = 4
+};
+
+// Levels below SCRABBLE_LOG_LEVEL are compiled out entirely, so their
+// messages are never even formatted. Release builds keep INFO and up.
+#ifndef SCRABBLE_LOG_LEVEL
+    #ifdef NDEBUG
+        #define SCRABBLE_LOG_LEVEL 2
+    #else
+        #define SCRABBLE_LOG_LEVEL 0
+    #endif
+#endif
+
+// Messages are handed to a writer thread through a fixed ring, so logging
+// never waits on the console. When the ring is full new messages are
+// dropped and counted rather than blocking the caller.
+class Logger {
+private:
+    struct Record {
+        LogLevel level;
+        double seconds;       // since the logger started
+        std::string text;
+    };
+
+    static const size_t RING_SIZE = 1024;
+
+    std::vector<Record> ring;
+    uint64_t head;            // next record to fill
+    uint64_t tail;            // next record for the writer
+    uint64_t written;         // records fully written out
+    uint64_t dropped;
+    bool stopping;
+    std::atomic<int> minLevel;
+    std::chrono::steady_clock::time_point startTime;
+
+    std::mutex mutex;
+    std::condition_variable pending;
+    std::condition_variable drained;
+    std::thread writer;
+
+    Logger();
+    void writerLoop();
+
+public:
+    ~Logger();
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    static Logger& instance();
+    static const char* levelName(LogLevel level);
+
+    bool isEnabled(LogLevel level) const {
+        return static_cast<int>(level) >= minLevel.load(std::memory_order_relaxed);
+    }
+    void setLevel(LogLevel level);
+    LogLevel getLevel() const;
+
+    void write(LogLevel level, std::string text);
+    // Blocks until everything logged so far has reached the console.
+    void flush();
+    void shutdown();
+    uint64_t getDroppedCount();
+};
+
+#define SCRABBLE_LOG(level, message) \
+    do { \
+        if (Logger::instance().isEnabled(level)) { \
+            std::ostringstream logStream; \
+            logStream << message; \
+            Logger::instance().write(level, logStream.str()); \
+        } \
+    } while (0)
+
+#if SCRABBLE_LOG_LEVEL <= 0
+    #define LOG_TRACE(message) SCRABBLE_LOG(LogLevel::TRACE, message)
+#else
+    #define LOG_TRACE(message) do {} while (0)
+#endif
+
+#if SCRABBLE_LOG_LEVEL <= 1
+    #define LOG_DEBUG(message) SCRABBLE_LOG(LogLevel::DEBUG, message)
+#else
+    #define LOG_DEBUG(message) do {} while (0)
+#endif
+
+#if SCRABBLE_LOG_LEVEL <= 2
+    #define LOG_INFO(message) SCRABBLE_LOG(LogLevel::INFO, message)
+#else
+    #define LOG_INFO(message) do {} while (0)
+#endif
+
+#if SCRABBLE_LOG_LEVEL <= 3
+    #define LOG_WARN(message) SCRABBLE_LOG(LogLevel::WARN, message)
+#else
+    #define LOG_WARN(message) do {} while (0)
+#endif
+
+#define LOG_ERROR(message) SCRABBLE_LOG(LogLevel::ERR, message)
\ No newline at end of file
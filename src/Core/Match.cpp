@@ -0,0 +1,181 @@
+#include "Match.hpp"
+#include <algorithm>
+
+Match::Match(const Dictionary& dictionary, uint32_t seed)
+    : dictionary(dictionary), rngState(seed), currentPlayer(0), consecutivePasses(0),
+      consecutiveFailures(0), over(false) {
+    players[0] = Player("Player 1");
+    players[1] = Player("Player 2");
+    record.seed = seed;
+    record.lexiconId = dictionary.getLexiconId();
+    Rules::fillBag(tileBag, rngState);
+    drawUntilFull(players[0]);
+    drawUntilFull(players[1]);
+}
+
+void Match::drawUntilFull(Player& player) {
+    while (player.getRackSize() < Rules::RACK_SIZE && !tileBag.empty()) {
+        player.addTileToRack(tileBag.front());
+        tileBag.pop();
+    }
+}
+
+void Match::addRecord(RecordedMoveType type, int player, int score) {
+    record.moves.push_back({type, static_cast<uint8_t>(player), 0, 0, static_cast<int16_t>(score), {0}, {0}});
+}
+
+MoveStatus Match::play(int player, const std::vector<PlacedTile>& tiles, int& score) {
+    score = 0;
+    if (over) return MoveStatus::GAME_OVER;
+    if (player != currentPlayer) return MoveStatus::NOT_YOUR_TURN;
+    if (tiles.empty() || tiles.size() > static_cast<size_t>(Rules::RACK_SIZE)) return MoveStatus::BAD_PLACEMENT;
+
+    // Pair every tile with a rack tile before touching the board
+    const std::vector<Tile>& rack = players[player].getRack();
+    bool used[Rules::RACK_SIZE] = {false};
+    std::vector<int> rackIndices;
+    for (const PlacedTile& tile : tiles) {
+        if (tile.row >= Rules::BOARD_SIZE || tile.col >= Rules::BOARD_SIZE ||
+            tile.letter < 'A' || tile.letter > 'Z' || board.getTile(tile.row, tile.col)) {
+            return MoveStatus::BAD_PLACEMENT;
+        }
+        int found = -1;
+        for (size_t r = 0; r < rack.size() && found < 0; ++r) {
+            if (!used[r] && rack[r].getIsBlank() == tile.blank && (tile.blank || rack[r].getLetter() == tile.letter)) {
+                found = static_cast<int>(r);
+            }
+        }
+        if (found < 0) return MoveStatus::NOT_IN_RACK;
+        used[found] = true;
+        rackIndices.push_back(found);
+    }
+
+    std::vector<std::pair<int, int>> positions;
+    auto takeBack = [&]() {
+        for (const auto& pos : positions) board.removeTile(pos.first, pos.second);
+    };
+    for (size_t i = 0; i < tiles.size(); ++i) {
+        Tile placed = rack[rackIndices[i]];
+        if (tiles[i].blank) placed.setLetter(tiles[i].letter);
+        if (!board.placeTile(tiles[i].row, tiles[i].col, placed)) {
+            takeBack();
+            return MoveStatus::BAD_PLACEMENT;
+        }
+        positions.emplace_back(tiles[i].row, tiles[i].col);
+    }
+
+    const std::vector<WordInfo> words = Rules::findAllWordsFormed(board, positions);
+    if (Rules::checkPlacement(board, positions) != PlacementError::NONE || words.empty()) {
+        takeBack();
+        return MoveStatus::BAD_PLACEMENT;
+    }
+
+    for (const WordInfo& word : words) {
+        if (!dictionary.isValidWord(word.word)) {
+            takeBack();
+            addRecord(RecordedMoveType::INVALID_WORD, player);
+            if (++consecutiveFailures >= Rules::MAX_CONSECUTIVE_FAILURES) {
+                addRecord(RecordedMoveType::BONUS, 1 - player, Rules::FAILURE_BONUS);
+                players[1 - player].addScore(Rules::FAILURE_BONUS);
+                finish();
+            }
+            return MoveStatus::INVALID_WORD;
+        }
+        score += Rules::calculateWordScore(board, word);
+    }
+
+    RecordedMove move = {RecordedMoveType::PLAY, static_cast<uint8_t>(player), static_cast<uint8_t>(tiles.size()),
+                         0, static_cast<int16_t>(score), {0}, {0}};
+    for (size_t i = 0; i < tiles.size(); ++i) {
+        if (tiles[i].blank) move.blankMask |= 1 << i;
+        move.squares[i] = static_cast<uint8_t>(tiles[i].row * Rules::BOARD_SIZE + tiles[i].col);
+        move.letters[i] = tiles[i].letter;
+    }
+    record.moves.push_back(move);
+
+    std::sort(rackIndices.rbegin(), rackIndices.rend());
+    for (int index : rackIndices) players[player].removeTileFromRack(index);
+    players[player].addScore(score);
+    consecutivePasses = 0;
+    consecutiveFailures = 0;
+    drawUntilFull(players[0]);
+    drawUntilFull(players[1]);
+
+    if (tileBag.empty() && (players[0].getRackSize() == 0 || players[1].getRackSize() == 0)) {
+        finish();
+    } else {
+        currentPlayer = 1 - player;
+    }
+    return MoveStatus::OK;
+}
+
+MoveStatus Match::pass(int player) {
+    if (over) return MoveStatus::GAME_OVER;
+    if (player != currentPlayer) return MoveStatus::NOT_YOUR_TURN;
+
+    addRecord(RecordedMoveType::PASS, player);
+    if (++consecutivePasses >= Rules::MAX_CONSECUTIVE_PASSES) {
+        finish();
+        return MoveStatus::OK;
+    }
+    drawUntilFull(players[0]);
+    drawUntilFull(players[1]);
+    currentPlayer = 1 - player;
+    return MoveStatus::OK;
+}
+
+void Match::resign(int player) {
+    if (over) return;
+    currentPlayer = player;
+    finish();
+}
+
+void Match::finish() {
+    // Ties go to fewer tiles left, then to the lower value left, as in Game.
+    // The bonus is recorded before GAME_END, in the same order Game writes it.
+    if (players[0].getScore() == players[1].getScore()) {
+        int tiles[2], values[2];
+        for (int p = 0; p < 2; ++p) {
+            tiles[p] = players[p].getRackSize();
+            values[p] = 0;
+            for (const Tile& tile : players[p].getRack()) values[p] += tile.getPoints();
+        }
+        int winner = -1;
+        if (tiles[0] != tiles[1]) {
+            winner = tiles[0] < tiles[1] ? 0 : 1;
+        } else if (values[0] != values[1]) {
+            winner = values[0] < values[1] ? 0 : 1;
+        }
+        if (winner >= 0) {
+            addRecord(RecordedMoveType::BONUS, winner, 1);
+            players[winner].addScore(1);
+        }
+    }
+
+    addRecord(RecordedMoveType::GAME_END, currentPlayer);
+    over = true;
+}
+
+const Board& Match::getBoard() const {
+    return board;
+}
+
+const Player& Match::getPlayer(int index) const {
+    return players[index];
+}
+
+int Match::getCurrentPlayer() const {
+    return currentPlayer;
+}
+
+bool Match::isOver() const {
+    return over;
+}
+
+size_t Match::getBagSize() const {
+    return tileBag.size();
+}
+
+const GameRecord& Match::getRecord() const {
+    return record;
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+#include "Board.hpp"
+#include "Dictionary.hpp"
+#include "GameRecord.hpp"
+#include "Player.hpp"
+#include "Rules.hpp"
+#include <cstdint>
+#include <queue>
+#include <string>
+#include <vector>
+
+enum class MoveStatus : uint8_t {
+    OK = 0,
+    NOT_YOUR_TURN = 1,
+    GAME_OVER = 2,
+    BAD_PLACEMENT = 3,    // see Rules::checkPlacement; nothing changes
+    NOT_IN_RACK = 4,      // nothing changes
+    INVALID_WORD = 5      // counts as a failure, the player moves again
+};
+
+struct PlacedTile {
+    uint8_t row;
+    uint8_t col;
+    char letter;          // A-Z; for a blank, the letter it stands for
+    bool blank;
+};
+
+// One game with no window and no input handling: the same turn, scoring and
+// end-of-game rules as Game, driven by explicit moves. A server holds one per
+// session, so it stays small and never logs.
+class Match {
+private:
+    const Dictionary& dictionary;
+    Board board;
+    Player players[2];
+    std::queue<Tile> tileBag;
+    uint64_t rngState;
+    int currentPlayer;
+    int consecutivePasses;
+    int consecutiveFailures;
+    bool over;
+    GameRecord record;
+
+    void drawUntilFull(Player& player);
+    void addRecord(RecordedMoveType type, int player, int score = 0);
+    void finish();
+
+public:
+    Match(const Dictionary& dictionary, uint32_t seed);
+
+    // `score` receives the points for an accepted play.
+    MoveStatus play(int player, const std::vector<PlacedTile>& tiles, int& score);
+    MoveStatus pass(int player);
+    void resign(int player);
+
+    const Board& getBoard() const;
+    const Player& getPlayer(int index) const;
+    int getCurrentPlayer() const;
+    bool isOver() const;
+    size_t getBagSize() const;
+    const GameRecord& getRecord() const;
+};
\ No newline at end of file
@@ -0,0 +1,208 @@
+#include "MoveGenerator.hpp"
+#include "PerfCounters.hpp"
+#include "Rules.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+static const uint32_t ALL_LETTERS = (1u << 26) - 1;
+
+MoveGenerator::MoveGenerator(const Dictionary& dictionary)
+    : dictionary(dictionary), line(0), start(0), horizontal(true), rackTiles(0), blanksLeft(0), output(nullptr) {
+    std::memset(letters, 0, sizeof(letters));
+    std::memset(crossMasks, 0, sizeof(crossMasks));
+    std::memset(anchors, 0, sizeof(anchors));
+    std::memset(remaining, 0, sizeof(remaining));
+}
+
+size_t MoveGenerator::generate(const Board& board, const std::vector<Tile>& rack, std::vector<GeneratedMove>& moves,
+                               size_t maxMoves) {
+    const auto startTime = std::chrono::steady_clock::now();
+    moves.clear();
+
+    const LexiconTrie& trie = dictionary.getTrie();
+    if (!trie.isEmpty()) {
+        readBoard(board);
+
+        std::memset(remaining, 0, sizeof(remaining));
+        blanksLeft = 0;
+        for (const Tile& tile : rack) {
+            if (tile.getIsBlank()) {
+                ++blanksLeft;
+            } else if (tile.getLetter() >= 'A' && tile.getLetter() <= 'Z') {
+                ++remaining[tile.getLetter() - 'A'];
+            }
+        }
+        rackTiles = static_cast<int>(rack.size());
+        output = &moves;
+
+        for (int direction = 0; direction < 2; ++direction) {
+            horizontal = direction == 0;
+            for (line = 0; line < SIZE; ++line) {
+                // A line with no anchor holds no play
+                bool anchored = false;
+                for (int i = 0; i < SIZE && !anchored; ++i) {
+                    anchored = horizontal ? anchors[line][i] : anchors[i][line];
+                }
+                if (!anchored) continue;
+
+                for (start = 0; start < SIZE; ++start) {
+                    // A word cannot start right after a letter
+                    if (start > 0 && letterAt(start - 1)) continue;
+                    extend(LexiconTrie::ROOT, 0, 0, false);
+                }
+            }
+        }
+        output = nullptr;
+    }
+
+    std::stable_sort(moves.begin(), moves.end(), [](const GeneratedMove& a, const GeneratedMove& b) {
+        return a.score > b.score;
+    });
+    if (moves.size() > maxMoves) moves.resize(maxMoves);
+
+    const auto elapsed = std::chrono::steady_clock::now() - startTime;
+    PerfCounters::instance().recordMoveGeneration(
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()), moves.size());
+    return moves.size();
+}
+
+void MoveGenerator::readBoard(const Board& board) {
+    bool empty = true;
+    for (int row = 0; row < SIZE; ++row) {
+        for (int col = 0; col < SIZE; ++col) {
+            const Tile* tile = board.getTile(row, col);
+            letters[row][col] = tile ? tile->getLetter() : 0;
+            empty = empty && !tile;
+        }
+    }
+    scratch = board;
+
+    for (int row = 0; row < SIZE; ++row) {
+        for (int col = 0; col < SIZE; ++col) {
+            if (letters[row][col]) {
+                anchors[row][col] = false;
+                continue;
+            }
+            anchors[row][col] = (row > 0 && letters[row - 1][col]) || (row < SIZE - 1 && letters[row + 1][col]) ||
+                                (col > 0 && letters[row][col - 1]) || (col < SIZE - 1 && letters[row][col + 1]);
+            crossMasks[0][row][col] = crossMask(row, col, false);
+            crossMasks[1][row][col] = crossMask(row, col, true);
+        }
+    }
+    // The first play has to cover the centre
+    if (empty) anchors[Rules::CENTER][Rules::CENTER] = true;
+}
+
+uint32_t MoveGenerator::crossMask(int row, int col, bool acrossPlay) const {
+    // A play along a row meets the column's letters above and below the square
+    const int stepRow = acrossPlay ? 1 : 0;
+    const int stepCol = acrossPlay ? 0 : 1;
+
+    std::string before;
+    for (int r = row - stepRow, c = col - stepCol; r >= 0 && c >= 0 && letters[r][c]; r -= stepRow, c -= stepCol) {
+        before.insert(before.begin(), letters[r][c]);
+    }
+    std::string after;
+    for (int r = row + stepRow, c = col + stepCol; r < SIZE && c < SIZE && letters[r][c]; r += stepRow, c += stepCol) {
+        after.push_back(letters[r][c]);
+    }
+    if (before.empty() && after.empty()) return ALL_LETTERS;
+
+    uint32_t mask = 0;
+    std::string crossWord = before + ' ' + after;
+    for (int letter = 0; letter < 26; ++letter) {
+        crossWord[before.size()] = static_cast<char>('A' + letter);
+        if (dictionary.isValidWord(crossWord)) mask |= 1u << letter;
+    }
+    return mask;
+}
+
+char MoveGenerator::letterAt(int index) const {
+    return horizontal ? letters[line][index] : letters[index][line];
+}
+
+void MoveGenerator::extend(uint32_t node, int depth, int placed, bool anchored) {
+    const LexiconTrie& trie = dictionary.getTrie();
+    const int square = start + depth;
+
+    // The word may stop here only if the next square is empty
+    if (depth >= 2 && placed > 0 && anchored && trie.isTerminal(node) && (square == SIZE || !letterAt(square))) {
+        addMove(depth);
+    }
+    if (square == SIZE) return;
+
+    const uint32_t first = trie.getFirstChild(node);
+    const uint32_t count = trie.getChildCount(node);
+    const char fixed = letterAt(square);
+    if (fixed) {
+        for (uint32_t child = first; child < first + count; ++child) {
+            if (trie.getLetter(child) < fixed) continue;
+            if (trie.getLetter(child) == fixed) {
+                word[depth] = fixed;
+                blanks[depth] = false;
+                extend(child, depth + 1, placed, anchored);
+            }
+            return;
+        }
+        return;
+    }
+
+    if (placed == rackTiles) return;
+    const int row = horizontal ? line : square;
+    const int col = horizontal ? square : line;
+    const uint32_t mask = crossMasks[horizontal ? 1 : 0][row][col];
+    const bool nowAnchored = anchored || anchors[row][col];
+    for (uint32_t child = first; child < first + count; ++child) {
+        const char letter = trie.getLetter(child);
+        const int index = letter - 'A';
+        if (!((mask >> index) & 1)) continue;
+
+        // Spend a blank only when the letter itself has run out
+        word[depth] = letter;
+        if (remaining[index] > 0) {
+            --remaining[index];
+            blanks[depth] = false;
+            extend(child, depth + 1, placed + 1, nowAnchored);
+            ++remaining[index];
+        } else if (blanksLeft > 0) {
+            --blanksLeft;
+            blanks[depth] = true;
+            extend(child, depth + 1, placed + 1, nowAnchored);
+            ++blanksLeft;
+        }
+    }
+}
+
+void MoveGenerator::addMove(int length) {
+    GeneratedMove move;
+    for (int i = 0; i < length; ++i) {
+        const int row = horizontal ? line : start + i;
+        const int col = horizontal ? start + i : line;
+        if (letters[row][col]) continue;
+        move.tiles.push_back({static_cast<uint8_t>(row), static_cast<uint8_t>(col), word[i], blanks[i]});
+    }
+
+    // A lone tile with neighbours on both axes is found by both passes; keep the row's
+    if (!horizontal && move.tiles.size() == 1) {
+        const int row = move.tiles[0].row;
+        const int col = move.tiles[0].col;
+        if ((col > 0 && letters[row][col - 1]) || (col < SIZE - 1 && letters[row][col + 1])) return;
+    }
+
+    std::vector<std::pair<int, int>> positions;
+    for (const PlacedTile& placed : move.tiles) {
+        Tile tile = placed.blank ? Tile() : Tile(placed.letter);
+        if (placed.blank) tile.setLetter(placed.letter);
+        scratch.placeTile(placed.row, placed.col, tile);
+        positions.emplace_back(placed.row, placed.col);
+    }
+    move.score = 0;
+    for (const WordInfo& formed : Rules::findAllWordsFormed(scratch, positions)) {
+        move.score += Rules::calculateWordScore(scratch, formed);
+    }
+    for (const auto& position : positions) scratch.removeTile(position.first, position.second);
+
+    move.word.assign(word, length);
+    output->push_back(std::move(move));
+}
\ No newline at end of file
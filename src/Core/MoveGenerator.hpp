@@ -0,0 +1,57 @@
+#pragma once
+#include "Board.hpp"
+#include "Dictionary.hpp"
+#include "Match.hpp"
+#include "Tile.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct GeneratedMove {
+    std::vector<PlacedTile> tiles;
+    std::string word;       // the word along the line of play
+    int score;
+};
+
+// Finds every legal play for a rack. For each square a word could start on,
+// one walk of the lexicon trie follows the row or column: squares with a
+// letter allow only that letter, and empty squares allow the rack letters
+// that also make a valid cross word there. Plays are scored with Rules, so
+// scores agree with Game and Match. Needs the word lists loaded, not a
+// membership-only lexicon.
+class MoveGenerator {
+private:
+    static const int SIZE = Rules::BOARD_SIZE;
+
+    const Dictionary& dictionary;
+    char letters[SIZE][SIZE];            // 0 for an empty square
+    uint32_t crossMasks[2][SIZE][SIZE];  // [horizontal play][row][col]
+    bool anchors[SIZE][SIZE];            // empty squares a play must touch
+    Board scratch;                       // scores each candidate
+
+    // The walk in progress
+    int line;
+    int start;
+    bool horizontal;
+    int rackTiles;
+    int remaining[26];
+    int blanksLeft;
+    char word[SIZE];
+    bool blanks[SIZE];
+    std::vector<GeneratedMove>* output;
+
+    void readBoard(const Board& board);
+    uint32_t crossMask(int row, int col, bool acrossPlay) const;
+    char letterAt(int index) const;
+    void extend(uint32_t node, int depth, int placed, bool anchored);
+    void addMove(int length);
+
+public:
+    explicit MoveGenerator(const Dictionary& dictionary);
+
+    // Replaces `moves` with the plays for `rack`, highest score first, and
+    // keeps at most `maxMoves`. Reports its timing to PerfCounters.
+    size_t generate(const Board& board, const std::vector<Tile>& rack, std::vector<GeneratedMove>& moves,
+                    size_t maxMoves = SIZE_MAX);
+};
\ No newline at end of file
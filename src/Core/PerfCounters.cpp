@@ -0,0 +1,56 @@
+#include "PerfCounters.hpp"
+#include <fstream>
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+    #include <psapi.h>
+#elif defined(__linux__)
+    #include <unistd.h>
+#endif
+
+PerfCounters::PerfCounters() : lastMoveGenerationNanos(0), lastMovesGenerated(0), totalMovesGenerated(0) {}
+
+PerfCounters& PerfCounters::instance() {
+    static PerfCounters counters;
+    return counters;
+}
+
+void PerfCounters::recordMoveGeneration(uint64_t nanos, uint64_t moves) {
+    lastMoveGenerationNanos.store(nanos, std::memory_order_relaxed);
+    lastMovesGenerated.store(moves, std::memory_order_relaxed);
+    totalMovesGenerated.fetch_add(moves, std::memory_order_relaxed);
+}
+
+MoveGenerationStats PerfCounters::getMoveGenerationStats() const {
+    MoveGenerationStats stats;
+    stats.lastMillis = lastMoveGenerationNanos.load(std::memory_order_relaxed) / 1e6;
+    stats.lastMoves = lastMovesGenerated.load(std::memory_order_relaxed);
+    stats.totalMoves = totalMovesGenerated.load(std::memory_order_relaxed);
+    return stats;
+}
+
+size_t PerfCounters::getResidentMemoryBytes() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.WorkingSetSize;
+    }
+    return 0;
+#elif defined(__linux__)
+    // Second field of statm is the resident page count
+    std::ifstream statm("/proc/self/statm");
+    size_t totalPages = 0, residentPages = 0;
+    if (statm >> totalPages >> residentPages) {
+        return residentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+    return 0;
+#else
+    return 0;
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+struct MoveGenerationStats {
+    double lastMillis;          // duration of the most recent generation
+    uint64_t lastMoves;         // moves it produced
+    uint64_t totalMoves;        // since start-up
+};
+
+// Process-wide counters that the core updates and the performance HUD reads.
+// Updates are relaxed atomics so any thread may record.
+class PerfCounters {
+private:
+    std::atomic<uint64_t> lastMoveGenerationNanos;
+    std::atomic<uint64_t> lastMovesGenerated;
+    std::atomic<uint64_t> totalMovesGenerated;
+
+    PerfCounters();
+
+public:
+    static PerfCounters& instance();
+
+    void recordMoveGeneration(uint64_t nanos, uint64_t moves);
+    MoveGenerationStats getMoveGenerationStats() const;
+
+    // Resident set size of this process, or 0 where it cannot be queried.
+    static size_t getResidentMemoryBytes();
+};
\ No newline at end of file
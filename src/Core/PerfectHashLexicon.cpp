@@ -0,0 +1,307 @@
+#include "PerfectHashLexicon.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+using namespace std;
+
+// Average keys per bucket and the fraction of slots used while searching pilots.
+// Together they keep the pilots at ~0.5 bytes per word and the search under a second.
+static const double KEYS_PER_BUCKET = 4.0;
+static const double LOAD_FACTOR = 0.98;
+static const uint32_t MAX_PILOT = 0xFFFF;
+static const int MAX_SEED_ATTEMPTS = 16;
+
+static uint64_t mix64(uint64_t value) {
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+static uint32_t fastRange(uint32_t value, uint32_t range) {
+    return static_cast<uint32_t>((static_cast<uint64_t>(value) * range) >> 32);
+}
+
+// Header: magic, version, seed (u64), key count, table size, bucket count.
+// The file is little-endian whatever the host, like the game records.
+static const size_t HEADER_BYTES = 28;
+
+static void putU16(vector<uint8_t>& out, uint16_t value) {
+    out.push_back(static_cast<uint8_t>(value));
+    out.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+static void putU32(vector<uint8_t>& out, uint32_t value) {
+    for (int shift = 0; shift < 32; shift += 8) out.push_back(static_cast<uint8_t>(value >> shift));
+}
+
+static void putU64(vector<uint8_t>& out, uint64_t value) {
+    for (int shift = 0; shift < 64; shift += 8) out.push_back(static_cast<uint8_t>(value >> shift));
+}
+
+static uint16_t getU16(const uint8_t* data) {
+    return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+
+static uint32_t getU32(const uint8_t* data) {
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+           (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+static uint64_t getU64(const uint8_t* data) {
+    return static_cast<uint64_t>(getU32(data)) | (static_cast<uint64_t>(getU32(data + 4)) << 32);
+}
+
+PerfectHashLexicon::PerfectHashLexicon() : seed(0), keyCount(0), tableSize(0), bucketCount(0) {}
+
+uint64_t PerfectHashLexicon::hashKey(const char* data, size_t length, uint64_t seed) {
+    uint64_t hash = 14695981039346656037ULL ^ seed;
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+    return mix64(hash);
+}
+
+uint64_t PerfectHashLexicon::mixPilot(uint64_t pilot) {
+    return mix64(pilot * 0x9E3779B97F4A7C15ULL + 1);
+}
+
+uint16_t PerfectHashLexicon::fingerprintOf(uint64_t hash) {
+    return static_cast<uint16_t>(hash);
+}
+
+uint32_t PerfectHashLexicon::bucketOf(uint64_t hash) const {
+    return fastRange(static_cast<uint32_t>(hash >> 32), bucketCount);
+}
+
+uint32_t PerfectHashLexicon::slotOf(uint64_t hash, uint16_t pilot) const {
+    return fastRange(static_cast<uint32_t>(mix64(hash ^ mixPilot(pilot)) >> 32), tableSize);
+}
+
+bool PerfectHashLexicon::tryBuild(const std::vector<uint64_t>& hashes) {
+    // Group keys by bucket (counting sort), then place the largest buckets first
+    vector<uint32_t> bucketStart(bucketCount + 1, 0);
+    vector<uint32_t> keyBucket(keyCount);
+    for (uint32_t i = 0; i < keyCount; ++i) {
+        keyBucket[i] = bucketOf(hashes[i]);
+        ++bucketStart[keyBucket[i] + 1];
+    }
+    for (uint32_t b = 0; b < bucketCount; ++b) {
+        bucketStart[b + 1] += bucketStart[b];
+    }
+    vector<uint32_t> bucketKeys(keyCount);
+    vector<uint32_t> fill(bucketStart.begin(), bucketStart.end() - 1);
+    for (uint32_t i = 0; i < keyCount; ++i) {
+        bucketKeys[fill[keyBucket[i]]++] = i;
+    }
+
+    vector<uint32_t> order(bucketCount);
+    for (uint32_t b = 0; b < bucketCount; ++b) order[b] = b;
+    stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return bucketStart[a + 1] - bucketStart[a] > bucketStart[b + 1] - bucketStart[b];
+    });
+
+    vector<uint32_t> slotOwner(tableSize, UINT32_MAX);
+    vector<uint32_t> candidate;
+    pilots.assign(bucketCount, 0);
+
+    for (uint32_t bucket : order) {
+        const uint32_t begin = bucketStart[bucket];
+        const uint32_t end = bucketStart[bucket + 1];
+        if (begin == end) break;
+
+        bool placed = false;
+        for (uint32_t pilot = 0; pilot <= MAX_PILOT && !placed; ++pilot) {
+            candidate.clear();
+            bool available = true;
+            for (uint32_t k = begin; k < end && available; ++k) {
+                uint32_t slot = slotOf(hashes[bucketKeys[k]], static_cast<uint16_t>(pilot));
+                available = slotOwner[slot] == UINT32_MAX &&
+                       std::find(candidate.begin(), candidate.end(), slot) == candidate.end();
+                candidate.push_back(slot);
+            }
+            if (!available) continue;
+
+            for (uint32_t k = begin; k < end; ++k) {
+                slotOwner[candidate[k - begin]] = bucketKeys[k];
+            }
+            pilots[bucket] = static_cast<uint16_t>(pilot);
+            placed = true;
+        }
+        if (!placed) return false;
+    }
+
+    // Fold the slots past keyCount into the holes left below it so the
+    // fingerprint array is exactly one entry per word
+    remap.assign(tableSize - keyCount, 0);
+    fingerprints.assign(keyCount, 0);
+    uint32_t hole = 0;
+    for (uint32_t slot = 0; slot < tableSize; ++slot) {
+        if (slotOwner[slot] == UINT32_MAX) continue;
+
+        uint32_t target = slot;
+        if (slot >= keyCount) {
+            while (slotOwner[hole] != UINT32_MAX) ++hole;
+            target = hole++;
+            remap[slot - keyCount] = target;
+        }
+        fingerprints[target] = fingerprintOf(hashes[slotOwner[slot]]);
+    }
+    return true;
+}
+
+bool PerfectHashLexicon::build(const std::vector<std::string>& words) {
+    clear();
+    if (words.empty() || words.size() >= UINT32_MAX) return false;
+
+    keyCount = static_cast<uint32_t>(words.size());
+    tableSize = std::max(keyCount, static_cast<uint32_t>(std::ceil(keyCount / LOAD_FACTOR)));
+    bucketCount = std::max<uint32_t>(1, static_cast<uint32_t>(std::ceil(keyCount / KEYS_PER_BUCKET)));
+
+    vector<uint64_t> hashes(keyCount);
+    for (int attempt = 0; attempt < MAX_SEED_ATTEMPTS; ++attempt) {
+        seed = mix64(0x5CB1ULL + attempt);
+        for (uint32_t i = 0; i < keyCount; ++i) {
+            hashes[i] = hashKey(words[i].data(), words[i].size(), seed);
+        }
+
+        // Two keys with the same 64-bit hash can never be separated by a pilot
+        vector<uint64_t> sorted(hashes);
+        sort(sorted.begin(), sorted.end());
+        if (adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) continue;
+
+        if (tryBuild(hashes)) return true;
+    }
+
+    LOG_ERROR("Failed to build perfect hash for " << keyCount << " words");
+    clear();
+    return false;
+}
+
+bool PerfectHashLexicon::saveToFile(const std::string& filename) const {
+    ofstream file(filename, ios::binary | ios::trunc);
+    if (!file.is_open()) {
+        LOG_ERROR("Error opening lexicon file for writing: " << filename);
+        return false;
+    }
+
+    vector<uint8_t> bytes;
+    bytes.reserve(HEADER_BYTES + pilots.size() * 2 + remap.size() * 4 + fingerprints.size() * 2);
+    putU32(bytes, FILE_MAGIC);
+    putU32(bytes, FILE_VERSION);
+    putU64(bytes, seed);
+    putU32(bytes, keyCount);
+    putU32(bytes, tableSize);
+    putU32(bytes, bucketCount);
+    for (uint16_t pilot : pilots) putU16(bytes, pilot);
+    for (uint32_t slot : remap) putU32(bytes, slot);
+    for (uint16_t fingerprint : fingerprints) putU16(bytes, fingerprint);
+
+    if (!file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<streamsize>(bytes.size()))) {
+        LOG_ERROR("Error writing lexicon file: " << filename);
+        return false;
+    }
+    return true;
+}
+
+bool PerfectHashLexicon::loadFromFile(const std::string& filename) {
+    clear();
+
+    ifstream file(filename, ios::binary | ios::ate);
+    if (!file.is_open()) {
+        LOG_ERROR("Error opening lexicon file: " << filename);
+        return false;
+    }
+
+    const streamsize size = file.tellg();
+    vector<uint8_t> bytes(static_cast<size_t>(size > 0 ? size : 0));
+    file.seekg(0, ios::beg);
+    bool valid = bytes.size() >= HEADER_BYTES &&
+                 file.read(reinterpret_cast<char*>(bytes.data()), size) &&
+                 getU32(bytes.data()) == FILE_MAGIC && getU32(bytes.data() + 4) == FILE_VERSION;
+
+    uint32_t keys = 0, slots = 0, buckets = 0;
+    if (valid) {
+        keys = getU32(bytes.data() + 16);
+        slots = getU32(bytes.data() + 20);
+        buckets = getU32(bytes.data() + 24);
+        // The counts size the arrays, so they must account for the file exactly
+        // before anything is allocated from them
+        valid = keys > 0 && slots >= keys && buckets > 0 &&
+                bytes.size() == HEADER_BYTES + uint64_t(buckets) * 2 + uint64_t(slots - keys) * 4 + uint64_t(keys) * 2;
+    }
+
+    if (valid) {
+        seed = getU64(bytes.data() + 8);
+        keyCount = keys;
+        tableSize = slots;
+        bucketCount = buckets;
+
+        const uint8_t* data = bytes.data() + HEADER_BYTES;
+        pilots.resize(bucketCount);
+        for (size_t i = 0; i < pilots.size(); ++i, data += 2) pilots[i] = getU16(data);
+        remap.resize(tableSize - keyCount);
+        for (size_t i = 0; i < remap.size(); ++i, data += 4) remap[i] = getU32(data);
+        fingerprints.resize(keyCount);
+        for (size_t i = 0; i < fingerprints.size(); ++i, data += 2) fingerprints[i] = getU16(data);
+    }
+    for (size_t i = 0; valid && i < remap.size(); ++i) {
+        valid = remap[i] < keyCount;
+    }
+
+    if (!valid) {
+        LOG_ERROR("Invalid lexicon file: " << filename);
+        clear();
+        return false;
+    }
+    return true;
+}
+
+void PerfectHashLexicon::clear() {
+    seed = 0;
+    keyCount = 0;
+    tableSize = 0;
+    bucketCount = 0;
+    pilots.clear();
+    remap.clear();
+    fingerprints.clear();
+}
+
+bool PerfectHashLexicon::contains(const char* data, size_t length) const {
+    if (keyCount == 0) return false;
+
+    const uint64_t hash = hashKey(data, length, seed);
+    uint32_t slot = slotOf(hash, pilots[bucketOf(hash)]);
+    if (slot >= keyCount) {
+        slot = remap[slot - keyCount];
+    }
+    return fingerprints[slot] == fingerprintOf(hash);
+}
+
+bool PerfectHashLexicon::contains(const std::string& word) const {
+    return contains(word.data(), word.size());
+}
+
+bool PerfectHashLexicon::isEmpty() const {
+    return keyCount == 0;
+}
+
+size_t PerfectHashLexicon::getWordCount() const {
+    return keyCount;
+}
+
+uint64_t PerfectHashLexicon::getTableId() const {
+    uint64_t id = mix64(seed ^ keyCount);
+    id = mix64(id ^ tableSize);
+    return mix64(id ^ bucketCount);
+}
+
+size_t PerfectHashLexicon::getSizeBytes() const {
+    return pilots.size() * sizeof(uint16_t) + remap.size() * sizeof(uint32_t) +
+           fingerprints.size() * sizeof(uint16_t);
+}
\ No newline at end of file
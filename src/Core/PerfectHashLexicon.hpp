@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Membership-only lexicon: a minimal perfect hash (hash-and-displace with one
+// 16-bit pilot per bucket) maps every word to its own slot, and each slot keeps
+// a 16-bit fingerprint of the word that lives there. A lookup is one hash and
+// one fingerprint comparison; a word that is not in the list is accepted with
+// probability 1/65536. Tables are built offline (see tools/lexicon_builder.cpp).
+class PerfectHashLexicon {
+private:
+    static const uint32_t FILE_MAGIC = 0x4C485053;   // "SPHL"
+    static const uint32_t FILE_VERSION = 1;
+
+    uint64_t seed;
+    uint32_t keyCount;
+    uint32_t tableSize;      // slots searched by the pilots, slightly above keyCount
+    uint32_t bucketCount;
+
+    std::vector<uint16_t> pilots;
+    std::vector<uint32_t> remap;          // slots >= keyCount folded back below it
+    std::vector<uint16_t> fingerprints;
+
+    static uint64_t hashKey(const char* data, size_t length, uint64_t seed);
+    static uint64_t mixPilot(uint64_t pilot);
+    static uint16_t fingerprintOf(uint64_t hash);
+
+    uint32_t bucketOf(uint64_t hash) const;
+    uint32_t slotOf(uint64_t hash, uint16_t pilot) const;
+
+    bool tryBuild(const std::vector<uint64_t>& hashes);
+
+public:
+    PerfectHashLexicon();
+
+    // Words must already be normalised (uppercase A-Z) and free of duplicates.
+    bool build(const std::vector<std::string>& words);
+    bool saveToFile(const std::string& filename) const;
+    bool loadFromFile(const std::string& filename);
+    void clear();
+
+    bool contains(const char* data, size_t length) const;
+    bool contains(const std::string& word) const;
+
+    bool isEmpty() const;
+    size_t getWordCount() const;
+    size_t getSizeBytes() const;
+    // Identifies this particular table build (seed and shape).
+    uint64_t getTableId() const;
+};
\ No newline at end of file
@@ -1,7 +1,7 @@
 #include "Player.hpp"
+#include "Logger.hpp"
 #include <algorithm>
 #include <random>
-#include <iostream>
 
 Player::Player() : name("Unknown"), score(0), playerType(PlayerType::HUMAN) {
     rack.reserve(RACK_SIZE);
@@ -158,6 +158,6 @@ bool Player::makeAIMove() {
         return false;
     }
     
-    std::cout << "AI " << name << " is thinking..." << std::endl;
+    LOG_DEBUG("AI " << name << " is thinking...");
     return true;
 }
\ No newline at end of file
@@ -0,0 +1,253 @@
+#include "Rules.hpp"
+#include <algorithm>
+#include <set>
+#include <string>
+
+uint64_t Rules::nextRandom(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+void Rules::fillBag(std::queue<Tile>& bag, uint64_t& rngState) {
+    struct TileInfo { char letter; int count; };
+
+    static const std::vector<Tile> fullBag = [] {
+        const std::vector<TileInfo> tileDistribution = {
+            {'A', 9}, {'B', 2}, {'C', 2}, {'D', 4}, {'E', 12}, {'F', 2},
+            {'G', 3}, {'H', 2}, {'I', 9}, {'J', 1}, {'K', 1}, {'L', 4},
+            {'M', 2}, {'N', 6}, {'O', 8}, {'P', 2}, {'Q', 1}, {'R', 6},
+            {'S', 4}, {'T', 6}, {'U', 4}, {'V', 2}, {'W', 2}, {'X', 1},
+            {'Y', 2}, {'Z', 1}, {' ', 2}
+        };
+
+        std::vector<Tile> tiles;
+        for (const auto& tileInfo : tileDistribution) {
+            for (int i = 0; i < tileInfo.count; ++i) {
+                tiles.push_back(tileInfo.letter == ' ' ? Tile() : Tile(tileInfo.letter));
+            }
+        }
+        return tiles;
+    }();
+
+    // Our own Fisher-Yates over tile indices: std::shuffle and the standard
+    // distributions draw differently in each standard library, and records
+    // must replay the same bag everywhere
+    uint8_t order[128];
+    for (size_t i = 0; i < fullBag.size(); ++i) {
+        order[i] = static_cast<uint8_t>(i);
+    }
+    for (size_t i = fullBag.size() - 1; i > 0; --i) {
+        std::swap(order[i], order[nextRandom(rngState) % (i + 1)]);
+    }
+
+    std::queue<Tile>().swap(bag);
+    for (size_t i = 0; i < fullBag.size(); ++i) {
+        bag.push(fullBag[order[i]]);
+    }
+}
+
+PlacementError Rules::checkPlacement(const Board& board, const std::vector<std::pair<int, int>>& positions) {
+    if (positions.empty()) return PlacementError::NO_TILES;
+
+    int minRow = BOARD_SIZE, maxRow = -1, minCol = BOARD_SIZE, maxCol = -1;
+    for (const auto& pos : positions) {
+        if (pos.first < 0 || pos.first >= BOARD_SIZE || pos.second < 0 || pos.second >= BOARD_SIZE ||
+            !board.getTile(pos.first, pos.second)) {
+            return PlacementError::OFF_BOARD;
+        }
+        minRow = std::min(minRow, pos.first);
+        maxRow = std::max(maxRow, pos.first);
+        minCol = std::min(minCol, pos.second);
+        maxCol = std::max(maxCol, pos.second);
+    }
+    if (minRow != maxRow && minCol != maxCol) return PlacementError::NOT_IN_LINE;
+
+    // Squares between the new tiles may hold old tiles, but none may be empty
+    for (int row = minRow; row <= maxRow; ++row) {
+        for (int col = minCol; col <= maxCol; ++col) {
+            if (!board.getTile(row, col)) return PlacementError::GAP;
+        }
+    }
+
+    auto isNew = [&](int row, int col) {
+        return std::find(positions.begin(), positions.end(), std::make_pair(row, col)) != positions.end();
+    };
+    bool boardHadTiles = false;
+    for (int row = 0; row < BOARD_SIZE && !boardHadTiles; ++row) {
+        for (int col = 0; col < BOARD_SIZE && !boardHadTiles; ++col) {
+            boardHadTiles = board.getTile(row, col) && !isNew(row, col);
+        }
+    }
+    if (!boardHadTiles) {
+        return isNew(CENTER, CENTER) ? PlacementError::NONE : PlacementError::MISSES_CENTER;
+    }
+
+    static const int neighbours[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+    for (const auto& pos : positions) {
+        for (const auto& step : neighbours) {
+            const int row = pos.first + step[0];
+            const int col = pos.second + step[1];
+            if (board.getTile(row, col) && !isNew(row, col)) return PlacementError::NONE;
+        }
+    }
+    return PlacementError::NOT_CONNECTED;
+}
+
+const char* Rules::describe(PlacementError error) {
+    switch (error) {
+        case PlacementError::NONE:          return "ok";
+        case PlacementError::NO_TILES:      return "no tiles placed";
+        case PlacementError::OFF_BOARD:     return "tile off the board";
+        case PlacementError::NOT_IN_LINE:   return "tiles not in one line";
+        case PlacementError::GAP:           return "gap between tiles";
+        case PlacementError::NOT_CONNECTED: return "not connected to the board";
+        case PlacementError::MISSES_CENTER: return "first move misses the centre";
+    }
+    return "unknown";
+}
+
+std::vector<WordInfo> Rules::findAllWordsFormed(const Board& board,
+                                                const std::vector<std::pair<int, int>>& positions) {
+    std::vector<WordInfo> allWords;
+    std::set<std::string> processedWords;
+    
+    if (positions.empty()) return allWords;
+    
+    auto sortedPositions = positions;
+    std::sort(sortedPositions.begin(), sortedPositions.end(), 
+        [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+            if (a.first == b.first) return a.second < b.second;
+            return a.first < b.first;
+        });
+    
+    bool mainIsHorizontal = (sortedPositions[0].first == sortedPositions.back().first);
+    
+    WordInfo mainWord = findWordAtPosition(
+        board,
+        sortedPositions[0].first, 
+        sortedPositions[0].second, 
+        mainIsHorizontal
+    );
+    
+    if (mainWord.word.length() > 1) {
+        for (const auto& pos : positions) {
+            if (std::find(mainWord.positions.begin(), mainWord.positions.end(), pos) != mainWord.positions.end()) {
+                mainWord.newTilePositions.push_back(pos);
+            }
+        }
+        allWords.push_back(mainWord);
+        processedWords.insert(mainWord.word + std::to_string(mainWord.startRow) + std::to_string(mainWord.startCol));
+    }
+
+    for (const auto& pos : positions) {
+        WordInfo crossWord = findWordAtPosition(board, pos.first, pos.second, !mainIsHorizontal);
+        
+        if (crossWord.word.length() > 1) {
+            std::string key = crossWord.word + std::to_string(crossWord.startRow) + std::to_string(crossWord.startCol);
+            if (processedWords.find(key) == processedWords.end()) {
+                crossWord.newTilePositions.push_back(pos);
+                allWords.push_back(crossWord);
+                processedWords.insert(key);
+            }
+        }
+    }
+    
+    return allWords;
+}
+
+WordInfo Rules::findWordAtPosition(const Board& board, int row, int col, bool horizontal) {
+    WordInfo wordInfo;
+    wordInfo.isHorizontal = horizontal;
+    
+    if (horizontal) {
+        int startCol = col;
+        int endCol = col;
+        
+        while (startCol > 0 && board.getTile(row, startCol - 1) != nullptr) {
+            startCol--;
+        }
+        
+        while (endCol < BOARD_SIZE - 1 && board.getTile(row, endCol + 1) != nullptr) {
+            endCol++;
+        }
+        
+        wordInfo.startRow = row;
+        wordInfo.startCol = startCol;
+        
+        for (int c = startCol; c <= endCol; c++) {
+            const Tile* tile = board.getTile(row, c);
+            if (tile) {
+                wordInfo.word += tile->getLetter();
+                wordInfo.positions.push_back({row, c});
+            }
+        }
+    } else {
+        int startRow = row;
+        int endRow = row;
+        
+        while (startRow > 0 && board.getTile(startRow - 1, col) != nullptr) {
+            startRow--;
+        }
+        
+        while (endRow < BOARD_SIZE - 1 && board.getTile(endRow + 1, col) != nullptr) {
+            endRow++;
+        }
+        
+        wordInfo.startRow = startRow;
+        wordInfo.startCol = col;
+        
+        for (int r = startRow; r <= endRow; r++) {
+            const Tile* tile = board.getTile(r, col);
+            if (tile) {
+                wordInfo.word += tile->getLetter();
+                wordInfo.positions.push_back({r, col});
+            }
+        }
+    }
+    
+    return wordInfo;
+}
+
+int Rules::calculateWordScore(const Board& board, const WordInfo& wordInfo) {
+    int score = 0;
+    int wordMultiplier = 1;
+    
+    for (const auto& pos : wordInfo.positions) {
+        const Tile* tile = board.getTile(pos.first, pos.second);
+        if (tile) {
+            int letterPoints = tile->getPoints();
+            
+            bool isNewlyPlaced = std::find(wordInfo.newTilePositions.begin(), 
+                                         wordInfo.newTilePositions.end(), 
+                                         pos) != wordInfo.newTilePositions.end();
+            
+            if (isNewlyPlaced) {
+                SpecialSquare special = board.getSpecialSquare(pos.first, pos.second);
+                
+                switch (special) {
+                    case SpecialSquare::DOUBLE_LETTER:
+                        letterPoints *= 2;
+                        break;
+                    case SpecialSquare::TRIPLE_LETTER:
+                        letterPoints *= 3;
+                        break;
+                    case SpecialSquare::DOUBLE_WORD:
+                    case SpecialSquare::CENTER:
+                        wordMultiplier *= 2;
+                        break;
+                    case SpecialSquare::TRIPLE_WORD:
+                        wordMultiplier *= 3;
+                        break;
+                    default:
+                        break;
+                }
+            }
+            
+            score += letterPoints;
+        }
+    }
+    
+    return score * wordMultiplier;
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+#include "Board.hpp"
+#include "Tile.hpp"
+#include <cstdint>
+#include <queue>
+#include <utility>
+#include <vector>
+
+enum class PlacementError {
+    NONE,
+    NO_TILES,
+    OFF_BOARD,
+    NOT_IN_LINE,        // the new tiles share neither a row nor a column
+    GAP,                // an empty square between the new tiles
+    NOT_CONNECTED,      // touches none of the tiles already on the board
+    MISSES_CENTER       // first move does not cover the centre square
+};
+
+// The game rules that need no window: the seeded bag, where a move may go,
+// which words it forms and what they score. Game, the match server and the
+// command line tools all share these, so a move scores the same everywhere.
+class Rules {
+public:
+    static const int BOARD_SIZE = 15;
+    static const int CENTER = 7;
+    static const int RACK_SIZE = 7;
+    static const int MAX_CONSECUTIVE_PASSES = 6;
+    static const int MAX_CONSECUTIVE_FAILURES = 6;
+    static const int FAILURE_BONUS = 50;      // to the opponent of a player who keeps failing
+
+    // splitmix64: identical on every standard library, so seeds replay anywhere
+    static uint64_t nextRandom(uint64_t& state);
+    // Replaces `bag` with the 100 standard tiles shuffled from `rngState`.
+    static void fillBag(std::queue<Tile>& bag, uint64_t& rngState);
+
+    // `positions` are the move's tiles, already on `board`.
+    static PlacementError checkPlacement(const Board& board, const std::vector<std::pair<int, int>>& positions);
+    static const char* describe(PlacementError error);
+
+    static WordInfo findWordAtPosition(const Board& board, int row, int col, bool horizontal);
+    // The main word and every cross word of two letters or more.
+    static std::vector<WordInfo> findAllWordsFormed(const Board& board,
+                                                    const std::vector<std::pair<int, int>>& positions);
+    // Premium squares count only under the word's new tiles.
+    static int calculateWordScore(const Board& board, const WordInfo& wordInfo);
+};
\ No newline at end of file
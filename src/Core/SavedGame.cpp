@@ -0,0 +1,227 @@
+#include "SavedGame.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#endif
+
+static const size_t CHECKSUM_OFFSET = 8;
+
+static void storeU16(uint8_t* out, uint16_t value) {
+    out[0] = static_cast<uint8_t>(value);
+    out[1] = static_cast<uint8_t>(value >> 8);
+}
+
+static void storeU32(uint8_t* out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) out[i] = static_cast<uint8_t>(value >> (8 * i));
+}
+
+static void storeU64(uint8_t* out, uint64_t value) {
+    for (int i = 0; i < 8; ++i) out[i] = static_cast<uint8_t>(value >> (8 * i));
+}
+
+static uint16_t loadU16(const uint8_t* data) {
+    return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+
+static uint32_t loadU32(const uint8_t* data) {
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+           (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+static uint64_t loadU64(const uint8_t* data) {
+    return static_cast<uint64_t>(loadU32(data)) | (static_cast<uint64_t>(loadU32(data + 4)) << 32);
+}
+
+static void adler32Update(uint32_t& sumA, uint32_t& sumB, const uint8_t* data, size_t size) {
+    // Sum in locals: the byte pointer may alias the references
+    uint32_t a = sumA, b = sumB;
+    while (size > 0) {
+        // 5552 bytes is the most that can be summed before the modulo overflows
+        const size_t chunk = std::min<size_t>(size, 5552);
+        for (size_t i = 0; i < chunk; ++i) {
+            a += data[i];
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+        data += chunk;
+        size -= chunk;
+    }
+    sumA = a;
+    sumB = b;
+}
+
+static uint32_t adler32(const uint8_t* data, size_t size) {
+    static const uint8_t zeroes[4] = {0, 0, 0, 0};
+    uint32_t a = 1, b = 0;
+    // The checksum field itself counts as zero
+    adler32Update(a, b, data, CHECKSUM_OFFSET);
+    adler32Update(a, b, zeroes, 4);
+    adler32Update(a, b, data + CHECKSUM_OFFSET + 4, size - CHECKSUM_OFFSET - 4);
+    return (b << 16) | a;
+}
+
+static bool isValidTileCode(uint8_t code) {
+    const char letter = static_cast<char>(code & ~SavedGame::BLANK_BIT);
+    return (letter >= 'A' && letter <= 'Z') || (letter == ' ' && (code & SavedGame::BLANK_BIT));
+}
+
+SavedGame::SavedGame()
+    : seed(0), rngState(0), scores{0, 0}, gameMode(0), gameState(0), currentPlayer(0),
+      consecutivePasses(0), consecutiveFailures(0), rackSizes{0, 0}, bagSize(0) {
+    std::memset(board, 0, sizeof(board));
+    std::memset(racks, 0, sizeof(racks));
+    std::memset(bag, 0, sizeof(bag));
+    std::memset(names, 0, sizeof(names));
+}
+
+uint8_t SavedGame::encodeTile(const Tile& tile) {
+    // A blank given a letter keeps that letter but scores nothing
+    const bool blank = tile.getIsBlank() || tile.getPoints() == 0;
+    return static_cast<uint8_t>(tile.getLetter()) | (blank ? BLANK_BIT : 0);
+}
+
+Tile SavedGame::decodeTile(uint8_t code) {
+    const char letter = static_cast<char>(code & ~BLANK_BIT);
+    if (!(code & BLANK_BIT)) return Tile(letter);
+
+    Tile blank;
+    if (letter != ' ') blank.setLetter(letter);
+    return blank;
+}
+
+void SavedGame::appendTo(std::vector<uint8_t>& out) const {
+    const size_t start = out.size();
+    out.resize(start + STATE_BYTES, 0);
+    record.appendTo(out);
+
+    uint8_t* state = out.data() + start;
+    storeU32(state, FILE_MAGIC);
+    storeU16(state + 4, FILE_VERSION);
+    storeU16(state + 6, static_cast<uint16_t>(STATE_BYTES));
+    storeU32(state + 12, seed);
+    storeU64(state + 16, rngState);
+    storeU32(state + 24, static_cast<uint32_t>(scores[0]));
+    storeU32(state + 28, static_cast<uint32_t>(scores[1]));
+    state[32] = gameMode;
+    state[33] = gameState;
+    state[34] = currentPlayer;
+    state[35] = consecutivePasses;
+    state[36] = consecutiveFailures;
+    state[37] = rackSizes[0];
+    state[38] = rackSizes[1];
+    state[39] = bagSize;
+    std::memcpy(state + 40, board, BOARD_SQUARES);
+    std::memcpy(state + 265, racks, sizeof(racks));
+    std::memcpy(state + 279, bag, BAG_TILES);
+    std::memcpy(state + 379, names, sizeof(names));
+
+    storeU32(state + CHECKSUM_OFFSET, adler32(state, out.size() - start));
+}
+
+bool SavedGame::parse(const uint8_t* data, size_t size, SavedGame& game) {
+    if (size < STATE_BYTES || loadU32(data) != FILE_MAGIC || loadU16(data + 4) != FILE_VERSION ||
+        loadU16(data + 6) != STATE_BYTES || loadU32(data + CHECKSUM_OFFSET) != adler32(data, size)) {
+        return false;
+    }
+
+    game.seed = loadU32(data + 12);
+    game.rngState = loadU64(data + 16);
+    game.scores[0] = static_cast<int32_t>(loadU32(data + 24));
+    game.scores[1] = static_cast<int32_t>(loadU32(data + 28));
+    game.gameMode = data[32];
+    game.gameState = data[33];
+    game.currentPlayer = data[34];
+    game.consecutivePasses = data[35];
+    game.consecutiveFailures = data[36];
+    game.rackSizes[0] = data[37];
+    game.rackSizes[1] = data[38];
+    game.bagSize = data[39];
+    std::memcpy(game.board, data + 40, BOARD_SQUARES);
+    std::memcpy(game.racks, data + 265, sizeof(game.racks));
+    std::memcpy(game.bag, data + 279, BAG_TILES);
+    std::memcpy(game.names, data + 379, sizeof(game.names));
+    game.names[0][NAME_BYTES - 1] = '\0';
+    game.names[1][NAME_BYTES - 1] = '\0';
+
+    if (game.currentPlayer > 1 || game.rackSizes[0] > RACK_TILES || game.rackSizes[1] > RACK_TILES ||
+        game.bagSize > BAG_TILES) {
+        return false;
+    }
+    for (int i = 0; i < BOARD_SQUARES; ++i) {
+        if (game.board[i] && !isValidTileCode(game.board[i])) return false;
+    }
+    for (int p = 0; p < 2; ++p) {
+        for (int i = 0; i < game.rackSizes[p]; ++i) {
+            if (!isValidTileCode(game.racks[p][i])) return false;
+        }
+    }
+    for (int i = 0; i < game.bagSize; ++i) {
+        if (!isValidTileCode(game.bag[i])) return false;
+    }
+
+    size_t offset = STATE_BYTES;
+    return GameRecord::parse(data, size, offset, game.record) && offset == size;
+}
+
+bool SavedGame::writeFile(const std::string& filename) const {
+    std::vector<uint8_t> bytes;
+    appendTo(bytes);
+
+    const std::string temporary = filename + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            LOG_ERROR("Error opening save file: " << temporary);
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!file.flush()) {
+            LOG_ERROR("Error writing save file: " << temporary);
+            return false;
+        }
+    }
+
+#ifdef _WIN32
+    // rename() refuses to replace an existing file on Windows
+    const bool renamed = MoveFileExA(temporary.c_str(), filename.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    const bool renamed = std::rename(temporary.c_str(), filename.c_str()) == 0;
+#endif
+    if (!renamed) {
+        LOG_ERROR("Error replacing save file: " << filename);
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool SavedGame::readFile(const std::string& filename, SavedGame& game) {
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) return false;
+
+    const std::streamsize size = file.tellg();
+    std::vector<uint8_t> bytes(static_cast<size_t>(size > 0 ? size : 0));
+    file.seekg(0, std::ios::beg);
+    if (bytes.empty() || !file.read(reinterpret_cast<char*>(bytes.data()), size)) {
+        LOG_ERROR("Error reading save file: " << filename);
+        return false;
+    }
+
+    if (!parse(bytes.data(), bytes.size(), game)) {
+        LOG_WARN("Ignoring corrupt save file: " << filename);
+        return false;
+    }
+    return true;
+}
\ No newline at end of file
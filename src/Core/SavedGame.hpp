@@ -0,0 +1,61 @@
+#pragma once
+#include "GameRecord.hpp"
+#include "Tile.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// A game between turns: board, racks, bag order, scores and counters, plus
+// the record so far. The state is one fixed 448-byte block (little-endian)
+// followed by the game record, so saving is a handful of stores and one write:
+//     0  magic "SCRS", u16 version, u16 state size, u32 checksum
+//    12  u32 seed, u64 rng state, i32 score x2
+//    32  u8 game mode, game state, current player, passes, failures,
+//        rack sizes x2, bag size
+//    40  board, 225 squares      (0 empty, else letter | BLANK_BIT)
+//   265  racks, 2 x 7 tiles
+//   279  bag, 100 tiles          (next draw first)
+//   379  names, 2 x 16 bytes     (NUL padded)
+//   448  game record
+// The checksum is Adler-32 over the whole file with its own field zeroed.
+struct SavedGame {
+    static const uint32_t FILE_MAGIC = 0x53524353;   // "SCRS"
+    static const uint16_t FILE_VERSION = 1;
+    static const size_t STATE_BYTES = 448;
+    static const int BOARD_SQUARES = 15 * 15;
+    static const int RACK_TILES = 7;
+    static const int BAG_TILES = 100;
+    static const int NAME_BYTES = 16;
+    static const uint8_t BLANK_BIT = 0x80;
+
+    uint32_t seed;
+    uint64_t rngState;
+    int32_t scores[2];
+    uint8_t gameMode;
+    uint8_t gameState;
+    uint8_t currentPlayer;
+    uint8_t consecutivePasses;
+    uint8_t consecutiveFailures;
+    uint8_t rackSizes[2];
+    uint8_t bagSize;
+    uint8_t board[BOARD_SQUARES];
+    uint8_t racks[2][RACK_TILES];
+    uint8_t bag[BAG_TILES];
+    char names[2][NAME_BYTES];
+    GameRecord record;
+
+    SavedGame();
+
+    static uint8_t encodeTile(const Tile& tile);
+    static Tile decodeTile(uint8_t code);
+
+    void appendTo(std::vector<uint8_t>& out) const;
+    static bool parse(const uint8_t* data, size_t size, SavedGame& game);
+
+    // Writes a sibling temporary file and renames it over `filename`, so a
+    // crash mid-save leaves the previous save intact. There is no fsync: the
+    // save has to survive the process, not the machine.
+    bool writeFile(const std::string& filename) const;
+    static bool readFile(const std::string& filename, SavedGame& game);
+};
\ No newline at end of file
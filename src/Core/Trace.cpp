@@ -0,0 +1,117 @@
+#include "Trace.hpp"
+#include "Logger.hpp"
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+struct TraceEvent {
+    const char* name;
+    uint64_t startNanos;
+    uint64_t durationNanos;
+};
+
+static const size_t RING_SIZE = 1 << 15;
+
+struct ThreadRing {
+    // Left uninitialised: pages are only touched as spans are written
+    std::unique_ptr<TraceEvent[]> events;
+    std::atomic<uint64_t> count;        // spans ever recorded by the thread
+    std::atomic<const char*> threadName;
+    int threadId;
+
+    ThreadRing(int id, const char* name)
+        : events(new TraceEvent[RING_SIZE]), count(0), threadName(name), threadId(id) {}
+};
+
+static std::mutex registryMutex;
+static std::vector<std::unique_ptr<ThreadRing>> rings;
+
+static thread_local ThreadRing* threadRing = nullptr;
+static thread_local const char* threadName = nullptr;
+
+static const std::chrono::steady_clock::time_point traceEpoch = std::chrono::steady_clock::now();
+
+static ThreadRing* registerThread() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    rings.push_back(std::make_unique<ThreadRing>(static_cast<int>(rings.size()) + 1, threadName));
+    return rings.back().get();
+}
+
+static void writeEscaped(std::ostream& out, const char* text) {
+    for (const char* c = text; *c; ++c) {
+        if (*c == '"' || *c == '\\') out << '\\';
+        out << *c;
+    }
+}
+
+std::atomic<bool> Trace::enabled(false);
+
+void Trace::enable() {
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+void Trace::setThreadName(const char* name) {
+    threadName = name;
+    if (threadRing) {
+        threadRing->threadName.store(name, std::memory_order_relaxed);
+    }
+}
+
+uint64_t Trace::now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - traceEpoch).count());
+}
+
+void Trace::record(const char* name, uint64_t startNanos, uint64_t endNanos) {
+    if (!threadRing) {
+        threadRing = registerThread();
+    }
+
+    const uint64_t index = threadRing->count.load(std::memory_order_relaxed);
+    threadRing->events[index % RING_SIZE] = {name, startNanos, endNanos - startNanos};
+    threadRing->count.store(index + 1, std::memory_order_release);
+}
+
+bool Trace::writeJson(const std::string& filename) {
+    std::ofstream out(filename, std::ios::trunc);
+    if (!out.is_open()) {
+        LOG_ERROR("Error opening trace output: " << filename);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+    bool first = true;
+    for (const auto& ring : rings) {
+        const char* name = ring->threadName.load(std::memory_order_relaxed);
+        if (name) {
+            out << (first ? "" : ",\n") << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": "
+                << ring->threadId << ", \"args\": {\"name\": \"";
+            writeEscaped(out, name);
+            out << "\"}}";
+            first = false;
+        }
+
+        const uint64_t count = ring->count.load(std::memory_order_acquire);
+        const uint64_t begin = count > RING_SIZE ? count - RING_SIZE : 0;
+        for (uint64_t i = begin; i < count; ++i) {
+            const TraceEvent& event = ring->events[i % RING_SIZE];
+            // Chrome traces count in microseconds; keep the sub-microsecond part
+            out << (first ? "" : ",\n") << "{\"name\": \"";
+            writeEscaped(out, event.name);
+            out << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << ring->threadId
+                << ", \"ts\": " << event.startNanos / 1000 << "." << (event.startNanos % 1000) / 100
+                << ", \"dur\": " << event.durationNanos / 1000 << "." << (event.durationNanos % 1000) / 100 << "}";
+            first = false;
+        }
+    }
+    out << "\n]}\n";
+
+    if (!out) {
+        LOG_ERROR("Error writing trace output: " << filename);
+        return false;
+    }
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// Scoped timing spans written as a Chrome trace (chrome://tracing, Perfetto).
+// Each thread records into its own ring, so a span costs two clock reads and
+// a store; only a thread's first span takes a lock, to register its ring.
+// Span names must be string literals: only the pointer is kept.
+class Trace {
+private:
+    static std::atomic<bool> enabled;
+
+public:
+    static void enable();
+    static bool isEnabled() {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    // Label for the calling thread in the trace viewer (a string literal).
+    static void setThreadName(const char* name);
+
+    static uint64_t now();
+    static void record(const char* name, uint64_t startNanos, uint64_t endNanos);
+
+    // Call once the traced threads are idle, e.g. at shutdown. When a ring
+    // wrapped, only its most recent spans are written.
+    static bool writeJson(const std::string& filename);
+};
+
+class TraceScope {
+private:
+    const char* name;
+    uint64_t startNanos;
+    bool active;
+
+public:
+    explicit TraceScope(const char* spanName)
+        : name(spanName), startNanos(0), active(Trace::isEnabled()) {
+        if (active) startNanos = Trace::now();
+    }
+    ~TraceScope() {
+        if (active) Trace::record(name, startNanos, Trace::now());
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+
+#ifdef SCRABBLE_NO_TRACE
+    #define TRACE_SCOPE(name) do {} while (0)
+#else
+    #define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope, __LINE__)(name)
+#endif
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+// Hands the latest value from one writer thread to one reader thread without
+// locks. The writer fills the back slot and swaps it with the middle one; the
+// reader swaps the middle slot into the front only when a newer value is
+// waiting. Neither side blocks, and the reader never sees a half-written value.
+// Slots are reused, so T's assignment can keep its allocations.
+template <typename T>
+class TripleBuffer {
+private:
+    static const uint8_t INDEX_MASK = 0x3;
+    static const uint8_t FRESH_BIT = 0x4;    // middle holds a value the reader has not taken
+
+    T slots[3];
+    std::atomic<uint8_t> middle;
+    uint8_t back;     // writer only
+    uint8_t front;    // reader only
+
+public:
+    TripleBuffer() : middle(1), back(0), front(2) {}
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // Writer: fill this, then publish()
+    T& getWriteBuffer() {
+        return slots[back];
+    }
+
+    void publish() {
+        const uint8_t previous = middle.exchange(static_cast<uint8_t>(back | FRESH_BIT));
+        back = previous & INDEX_MASK;
+    }
+
+    // Reader: returns true when a newer value replaced the front slot
+    bool update() {
+        if (!(middle.load() & FRESH_BIT)) {
+            return false;
+        }
+        const uint8_t previous = middle.exchange(front);
+        front = previous & INDEX_MASK;
+        return true;
+    }
+
+    const T& read() const {
+        return slots[front];
+    }
+};
\ No newline at end of file
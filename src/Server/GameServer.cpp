@@ -0,0 +1,408 @@
+#include "GameServer.hpp"
+#include "../Core/Logger.hpp"
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+GameServer::Session::Session(const Dictionary& dictionary, uint32_t seed)
+    : match(dictionary, seed), seats{-1, -1} {}
+
+GameServer::GameServer(const Dictionary& dictionary)
+    : dictionary(dictionary), epollFd(epoll_create1(EPOLL_CLOEXEC)), tcpListener(-1), unixListener(-1),
+      nextMatchId(1), stopRequested(false), matchesStarted(0), matchesFinished(0), requestsHandled(0) {
+    if (epollFd < 0) {
+        LOG_ERROR("epoll_create1 failed: " << std::strerror(errno));
+    }
+}
+
+GameServer::~GameServer() {
+    for (const auto& entry : connections) close(entry.first);
+    if (tcpListener >= 0) close(tcpListener);
+    if (unixListener >= 0) {
+        close(unixListener);
+        unlink(unixPath.c_str());
+    }
+    if (epollFd >= 0) close(epollFd);
+}
+
+bool GameServer::addListener(int fd) {
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+    if (listen(fd, SOMAXCONN) != 0 || epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+        LOG_ERROR("Could not listen: " << std::strerror(errno));
+        close(fd);
+        return false;
+    }
+    return true;
+}
+
+bool GameServer::listenTcp(uint16_t port) {
+    if (epollFd < 0 || tcpListener >= 0) return false;
+
+    const int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        LOG_ERROR("Could not create TCP socket: " << std::strerror(errno));
+        return false;
+    }
+    const int enable = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(port);
+    if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        LOG_ERROR("Could not bind TCP port " << port << ": " << std::strerror(errno));
+        close(fd);
+        return false;
+    }
+    if (!addListener(fd)) return false;
+
+    tcpListener = fd;
+    LOG_INFO("Listening on TCP port " << getTcpPort());
+    return true;
+}
+
+bool GameServer::listenUnix(const std::string& path) {
+    sockaddr_un address = {};
+    if (epollFd < 0 || unixListener >= 0 || path.empty() || path.size() >= sizeof(address.sun_path)) return false;
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        LOG_ERROR("Could not create Unix socket: " << std::strerror(errno));
+        return false;
+    }
+
+    // A socket file left by an earlier run would make bind fail
+    unlink(path.c_str());
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        LOG_ERROR("Could not bind Unix socket " << path << ": " << std::strerror(errno));
+        close(fd);
+        return false;
+    }
+    if (!addListener(fd)) return false;
+
+    unixListener = fd;
+    unixPath = path;
+    LOG_INFO("Listening on Unix socket " << path);
+    return true;
+}
+
+uint16_t GameServer::getTcpPort() const {
+    sockaddr_in address = {};
+    socklen_t length = sizeof(address);
+    if (tcpListener < 0 || getsockname(tcpListener, reinterpret_cast<sockaddr*>(&address), &length) != 0) return 0;
+    return ntohs(address.sin_port);
+}
+
+bool GameServer::run() {
+    if (epollFd < 0 || (tcpListener < 0 && unixListener < 0)) {
+        LOG_ERROR("Game server has nothing to listen on");
+        return false;
+    }
+
+    epoll_event events[MAX_EVENTS];
+    while (!stopRequested.load(std::memory_order_relaxed)) {
+        const int count = epoll_wait(epollFd, events, MAX_EVENTS, POLL_TIMEOUT_MS);
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            LOG_ERROR("epoll_wait failed: " << std::strerror(errno));
+            return false;
+        }
+
+        for (int i = 0; i < count; ++i) {
+            const int fd = events[i].data.fd;
+            if (fd == tcpListener || fd == unixListener) {
+                acceptAll(fd);
+                continue;
+            }
+            // Closed earlier in this pass
+            if (connections.find(fd) == connections.end()) continue;
+
+            if (events[i].events & EPOLLERR) {
+                closeConnection(fd);
+                continue;
+            }
+            // A hang-up reads as end of stream
+            if (events[i].events & (EPOLLIN | EPOLLHUP)) readFrom(fd);
+            if ((events[i].events & EPOLLOUT) && connections.find(fd) != connections.end()) queue(fd);
+        }
+
+        // Flushing can close a connection, which can queue more output
+        for (size_t i = 0; i < dirty.size(); ++i) flush(dirty[i]);
+        dirty.clear();
+    }
+
+    LOG_INFO("Game server stopped: " << matchesStarted << " matches started, " << matchesFinished
+             << " finished, " << requestsHandled << " requests");
+    return true;
+}
+
+void GameServer::stop() {
+    stopRequested.store(true, std::memory_order_relaxed);
+}
+
+size_t GameServer::getSessionCount() const {
+    return sessions.size();
+}
+
+size_t GameServer::getConnectionCount() const {
+    return connections.size();
+}
+
+void GameServer::acceptAll(int listener) {
+    while (true) {
+        const int fd = accept4(listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                LOG_WARN("accept failed: " << std::strerror(errno));
+            }
+            return;
+        }
+
+        if (listener == tcpListener) {
+            // Replies are small and already batched per loop pass
+            const int enable = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+        }
+
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+            LOG_WARN("Could not watch connection: " << std::strerror(errno));
+            close(fd);
+            continue;
+        }
+        connections.emplace(fd, Connection{{}, {}, 0, 0, -1, false, false});
+    }
+}
+
+void GameServer::readFrom(int fd) {
+    uint8_t buffer[READ_CHUNK];
+    const ssize_t received = recv(fd, buffer, sizeof(buffer), 0);
+    if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) return;
+    if (received <= 0) {
+        closeConnection(fd);
+        return;
+    }
+
+    Connection& connection = connections.find(fd)->second;
+    connection.input.insert(connection.input.end(), buffer, buffer + received);
+
+    size_t offset = 0;
+    while (true) {
+        const size_t frame = Protocol::frameSize(connection.input.data() + offset, connection.input.size() - offset);
+        if (frame == SIZE_MAX) {
+            LOG_WARN("Dropping connection after a malformed frame");
+            closeConnection(fd);
+            return;
+        }
+        if (frame == 0) break;
+
+        handleFrame(fd, connection.input.data() + offset + Protocol::HEADER_BYTES, frame - Protocol::HEADER_BYTES);
+        offset += frame;
+    }
+    connection.input.erase(connection.input.begin(), connection.input.begin() + offset);
+}
+
+void GameServer::handleFrame(int fd, const uint8_t* payload, size_t size) {
+    ++requestsHandled;
+    Connection& connection = connections.find(fd)->second;
+    const MessageType type = static_cast<MessageType>(payload[0]);
+
+    switch (type) {
+        case MessageType::CREATE: {
+            uint32_t seed = 0;
+            if (connection.seat >= 0 || !Protocol::parseId(payload, size, seed)) {
+                sendResult(fd, type, Protocol::STATUS_BAD_REQUEST);
+                return;
+            }
+            const uint32_t matchId = nextMatchId++;
+            std::unique_ptr<Session> session(new Session(dictionary, seed));
+            session->seats[0] = fd;
+            sessions.emplace(matchId, std::move(session));
+            connection.matchId = matchId;
+            connection.seat = 0;
+            ++matchesStarted;
+            Protocol::appendSeated(queue(fd).output, matchId, 0);
+            return;
+        }
+        case MessageType::JOIN: {
+            uint32_t matchId = 0;
+            if (connection.seat >= 0 || !Protocol::parseId(payload, size, matchId)) {
+                sendResult(fd, type, Protocol::STATUS_BAD_REQUEST);
+                return;
+            }
+            auto found = sessions.find(matchId);
+            if (found == sessions.end() || found->second->seats[1] >= 0) {
+                sendResult(fd, type, Protocol::STATUS_NO_MATCH);
+                return;
+            }
+            found->second->seats[1] = fd;
+            connection.matchId = matchId;
+            connection.seat = 1;
+            Protocol::appendSeated(queue(fd).output, matchId, 1);
+            broadcastState(matchId, *found->second);
+            return;
+        }
+        case MessageType::PLAY:
+        case MessageType::PASS:
+        case MessageType::RESIGN:
+            handleMove(fd, connection, type, payload, size);
+            return;
+        default:
+            sendResult(fd, type, Protocol::STATUS_BAD_REQUEST);
+            return;
+    }
+}
+
+void GameServer::handleMove(int fd, Connection& connection, MessageType type, const uint8_t* payload, size_t size) {
+    auto found = connection.seat >= 0 ? sessions.find(connection.matchId) : sessions.end();
+    if (found == sessions.end()) {
+        sendResult(fd, type, Protocol::STATUS_NO_MATCH);
+        return;
+    }
+    Session& session = *found->second;
+    if (session.seats[1] < 0) {
+        sendResult(fd, type, Protocol::STATUS_WAITING);
+        return;
+    }
+
+    int score = 0;
+    MoveStatus status = MoveStatus::OK;
+    if (type == MessageType::PLAY) {
+        if (!Protocol::parsePlay(payload, size, placed)) {
+            sendResult(fd, type, Protocol::STATUS_BAD_REQUEST);
+            return;
+        }
+        status = session.match.play(connection.seat, placed, score);
+    } else if (type == MessageType::PASS) {
+        status = session.match.pass(connection.seat);
+    } else {
+        session.match.resign(connection.seat);
+    }
+
+    sendResult(fd, type, static_cast<uint8_t>(status), score);
+    // A rejected word changes nothing visible, but it can end the game
+    if (status == MoveStatus::OK || status == MoveStatus::INVALID_WORD) {
+        broadcastState(connection.matchId, session);
+    }
+    if (session.match.isOver()) endSession(connection.matchId);
+}
+
+void GameServer::sendResult(int fd, MessageType request, uint8_t status, int score) {
+    Protocol::appendResult(queue(fd).output, request, status, score);
+}
+
+void GameServer::broadcastState(uint32_t matchId, Session& session) {
+    for (int seat = 0; seat < 2; ++seat) {
+        if (session.seats[seat] >= 0) {
+            Protocol::appendState(queue(session.seats[seat]).output, matchId, session.match, seat);
+        }
+    }
+}
+
+void GameServer::endSession(uint32_t matchId) {
+    auto found = sessions.find(matchId);
+    if (found == sessions.end()) return;
+
+    const Match& match = found->second->match;
+    LOG_DEBUG("Match " << matchId << " over " << match.getPlayer(0).getScore() << "-"
+              << match.getPlayer(1).getScore() << " after " << match.getRecord().moves.size() << " moves");
+
+    // Both seats may create or join another match on the same connection
+    for (int fd : found->second->seats) {
+        auto connection = fd >= 0 ? connections.find(fd) : connections.end();
+        if (connection != connections.end()) {
+            connection->second.seat = -1;
+            connection->second.matchId = 0;
+        }
+    }
+    sessions.erase(found);
+    ++matchesFinished;
+}
+
+GameServer::Connection& GameServer::queue(int fd) {
+    Connection& connection = connections.find(fd)->second;
+    if (!connection.queued) {
+        connection.queued = true;
+        dirty.push_back(fd);
+    }
+    return connection;
+}
+
+void GameServer::flush(int fd) {
+    auto found = connections.find(fd);
+    if (found == connections.end()) return;
+    Connection& connection = found->second;
+    connection.queued = false;
+
+    while (connection.outputSent < connection.output.size()) {
+        const ssize_t sent = send(fd, connection.output.data() + connection.outputSent,
+                                  connection.output.size() - connection.outputSent, MSG_NOSIGNAL);
+        if (sent > 0) {
+            connection.outputSent += static_cast<size_t>(sent);
+        } else if (sent < 0 && errno == EINTR) {
+            continue;
+        } else if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        } else {
+            closeConnection(fd);
+            return;
+        }
+    }
+
+    if (connection.outputSent == connection.output.size()) {
+        connection.output.clear();
+        connection.outputSent = 0;
+    } else if (connection.output.size() - connection.outputSent > MAX_PENDING_OUTPUT) {
+        LOG_WARN("Dropping a connection that stopped reading");
+        closeConnection(fd);
+        return;
+    }
+
+    // Watch for writability only while output is waiting
+    const bool waiting = !connection.output.empty();
+    if (waiting != connection.writeWatched) {
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        if (waiting) event.events |= EPOLLOUT;
+        event.data.fd = fd;
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, fd, &event);
+        connection.writeWatched = waiting;
+    }
+}
+
+void GameServer::closeConnection(int fd) {
+    auto found = connections.find(fd);
+    if (found == connections.end()) return;
+
+    // Leaving a match resigns it; the opponent sees the final state
+    const uint32_t matchId = found->second.matchId;
+    const int seat = found->second.seat;
+    auto session = seat >= 0 ? sessions.find(matchId) : sessions.end();
+    if (session != sessions.end()) {
+        Session& leaving = *session->second;
+        leaving.seats[seat] = -1;
+        if (leaving.seats[1 - seat] >= 0) {
+            leaving.match.resign(seat);
+            broadcastState(matchId, leaving);
+        }
+        endSession(matchId);
+    }
+
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    close(fd);
+    connections.erase(found);
+}
\ No newline at end of file
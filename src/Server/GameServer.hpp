@@ -0,0 +1,86 @@
+#pragma once
+#include "../Core/Dictionary.hpp"
+#include "../Core/Match.hpp"
+#include "Protocol.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Hosts any number of two-seat matches on one thread: a level-triggered
+// epoll loop over non-blocking TCP and Unix sockets. Replies are queued per
+// connection and flushed once per loop pass, so a move costs one read and
+// at most one write for each seat. Linux only.
+class GameServer {
+private:
+    static const size_t READ_CHUNK = 16 * 1024;
+    static const size_t MAX_PENDING_OUTPUT = 1 << 20;   // a client this far behind is dropped
+    static const int MAX_EVENTS = 256;
+    static const int POLL_TIMEOUT_MS = 100;             // how often stop() is noticed
+
+    struct Connection {
+        std::vector<uint8_t> input;
+        std::vector<uint8_t> output;
+        size_t outputSent;
+        uint32_t matchId;
+        int seat;              // -1 until CREATE or JOIN
+        bool writeWatched;     // EPOLLOUT registered
+        bool queued;           // already in `dirty`
+    };
+
+    struct Session {
+        Match match;
+        int seats[2];          // connection fds, -1 while empty
+        Session(const Dictionary& dictionary, uint32_t seed);
+    };
+
+    const Dictionary& dictionary;
+    int epollFd;
+    int tcpListener;
+    int unixListener;
+    std::string unixPath;
+    std::unordered_map<int, Connection> connections;
+    std::unordered_map<uint32_t, std::unique_ptr<Session>> sessions;
+    std::vector<int> dirty;    // connections with output to flush
+    std::vector<PlacedTile> placed;
+    uint32_t nextMatchId;
+    std::atomic<bool> stopRequested;
+
+    uint64_t matchesStarted;
+    uint64_t matchesFinished;
+    uint64_t requestsHandled;
+
+    bool addListener(int fd);
+    void acceptAll(int listener);
+    void readFrom(int fd);
+    void handleFrame(int fd, const uint8_t* payload, size_t size);
+    void handleMove(int fd, Connection& connection, MessageType type, const uint8_t* payload, size_t size);
+    void sendResult(int fd, MessageType request, uint8_t status, int score = 0);
+    void broadcastState(uint32_t matchId, Session& session);
+    void endSession(uint32_t matchId);
+    Connection& queue(int fd);
+    void flush(int fd);
+    void closeConnection(int fd);
+
+public:
+    explicit GameServer(const Dictionary& dictionary);
+    ~GameServer();
+
+    GameServer(const GameServer&) = delete;
+    GameServer& operator=(const GameServer&) = delete;
+
+    // Port 0 picks a free port; see getTcpPort.
+    bool listenTcp(uint16_t port);
+    bool listenUnix(const std::string& path);
+    uint16_t getTcpPort() const;
+
+    // Serves until stop(); false if the loop could not start.
+    bool run();
+    // Safe from a signal handler or another thread.
+    void stop();
+
+    size_t getSessionCount() const;
+    size_t getConnectionCount() const;
+};
\ No newline at end of file
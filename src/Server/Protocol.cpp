@@ -0,0 +1,150 @@
+#include "Protocol.hpp"
+#include "../Core/SavedGame.hpp"
+#include <cstring>
+
+static void appendU32(std::vector<uint8_t>& out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+}
+
+static uint32_t loadU32(const uint8_t* data) {
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+           (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+// Reserves the length header; endFrame fills it in once the payload is written
+static size_t beginFrame(std::vector<uint8_t>& out, MessageType type) {
+    const size_t start = out.size();
+    out.resize(start + Protocol::HEADER_BYTES);
+    out.push_back(static_cast<uint8_t>(type));
+    return start;
+}
+
+static void endFrame(std::vector<uint8_t>& out, size_t start) {
+    const uint32_t payload = static_cast<uint32_t>(out.size() - start - Protocol::HEADER_BYTES);
+    for (int i = 0; i < 4; ++i) out[start + i] = static_cast<uint8_t>(payload >> (8 * i));
+}
+
+size_t Protocol::frameSize(const uint8_t* data, size_t size) {
+    if (size < HEADER_BYTES) return 0;
+    const uint32_t payload = loadU32(data);
+    if (payload == 0 || payload > MAX_PAYLOAD) return SIZE_MAX;
+    return size >= HEADER_BYTES + payload ? HEADER_BYTES + payload : 0;
+}
+
+void Protocol::appendCreate(std::vector<uint8_t>& out, uint32_t seed) {
+    const size_t start = beginFrame(out, MessageType::CREATE);
+    appendU32(out, seed);
+    endFrame(out, start);
+}
+
+void Protocol::appendJoin(std::vector<uint8_t>& out, uint32_t matchId) {
+    const size_t start = beginFrame(out, MessageType::JOIN);
+    appendU32(out, matchId);
+    endFrame(out, start);
+}
+
+void Protocol::appendPlay(std::vector<uint8_t>& out, const std::vector<PlacedTile>& tiles) {
+    const size_t start = beginFrame(out, MessageType::PLAY);
+    out.push_back(static_cast<uint8_t>(tiles.size()));
+    for (const PlacedTile& tile : tiles) {
+        out.push_back(static_cast<uint8_t>(tile.row * Rules::BOARD_SIZE + tile.col));
+        out.push_back(static_cast<uint8_t>(tile.letter | (tile.blank ? SavedGame::BLANK_BIT : 0)));
+    }
+    endFrame(out, start);
+}
+
+void Protocol::appendRequest(std::vector<uint8_t>& out, MessageType type) {
+    endFrame(out, beginFrame(out, type));
+}
+
+void Protocol::appendSeated(std::vector<uint8_t>& out, uint32_t matchId, uint8_t seat) {
+    const size_t start = beginFrame(out, MessageType::SEATED);
+    appendU32(out, matchId);
+    out.push_back(seat);
+    endFrame(out, start);
+}
+
+void Protocol::appendResult(std::vector<uint8_t>& out, MessageType request, uint8_t status, int score) {
+    const size_t start = beginFrame(out, MessageType::RESULT);
+    out.push_back(static_cast<uint8_t>(request));
+    out.push_back(status);
+    out.push_back(static_cast<uint8_t>(score));
+    out.push_back(static_cast<uint8_t>(score >> 8));
+    endFrame(out, start);
+}
+
+void Protocol::appendState(std::vector<uint8_t>& out, uint32_t matchId, const Match& match, int seat) {
+    const size_t start = beginFrame(out, MessageType::STATE);
+    appendU32(out, matchId);
+    out.push_back(static_cast<uint8_t>(match.getCurrentPlayer()));
+    out.push_back(match.isOver() ? 1 : 0);
+    out.push_back(static_cast<uint8_t>(match.getBagSize()));
+    appendU32(out, static_cast<uint32_t>(match.getPlayer(0).getScore()));
+    appendU32(out, static_cast<uint32_t>(match.getPlayer(1).getScore()));
+
+    const std::vector<Tile>& rack = match.getPlayer(seat).getRack();
+    out.push_back(static_cast<uint8_t>(rack.size()));
+    for (int i = 0; i < Rules::RACK_SIZE; ++i) {
+        out.push_back(i < static_cast<int>(rack.size()) ? SavedGame::encodeTile(rack[i]) : 0);
+    }
+
+    const Board& board = match.getBoard();
+    for (int row = 0; row < Rules::BOARD_SIZE; ++row) {
+        for (int col = 0; col < Rules::BOARD_SIZE; ++col) {
+            const Tile* tile = board.getTile(row, col);
+            out.push_back(tile ? SavedGame::encodeTile(*tile) : 0);
+        }
+    }
+    endFrame(out, start);
+}
+
+bool Protocol::parseId(const uint8_t* payload, size_t size, uint32_t& value) {
+    if (size != 5) return false;
+    value = loadU32(payload + 1);
+    return true;
+}
+
+bool Protocol::parsePlay(const uint8_t* payload, size_t size, std::vector<PlacedTile>& tiles) {
+    if (size < 2 || payload[1] == 0 || payload[1] > Rules::RACK_SIZE || size != 2 + 2u * payload[1]) return false;
+
+    tiles.clear();
+    for (int i = 0; i < payload[1]; ++i) {
+        const uint8_t square = payload[2 + 2 * i];
+        const uint8_t code = payload[3 + 2 * i];
+        if (square >= Rules::BOARD_SIZE * Rules::BOARD_SIZE) return false;
+        tiles.push_back({static_cast<uint8_t>(square / Rules::BOARD_SIZE), static_cast<uint8_t>(square % Rules::BOARD_SIZE),
+                         static_cast<char>(code & ~SavedGame::BLANK_BIT), (code & SavedGame::BLANK_BIT) != 0});
+    }
+    return true;
+}
+
+bool Protocol::parseSeated(const uint8_t* payload, size_t size, uint32_t& matchId, uint8_t& seat) {
+    if (size != 6) return false;
+    matchId = loadU32(payload + 1);
+    seat = payload[5];
+    return true;
+}
+
+bool Protocol::parseResult(const uint8_t* payload, size_t size, MessageType& request, uint8_t& status, int& score) {
+    if (size != 5) return false;
+    request = static_cast<MessageType>(payload[1]);
+    status = payload[2];
+    score = static_cast<int16_t>(payload[3] | (payload[4] << 8));
+    return true;
+}
+
+bool Protocol::parseState(const uint8_t* payload, size_t size, MatchState& state) {
+    if (size != STATE_PAYLOAD) return false;
+
+    const uint8_t* data = payload + 1;
+    state.matchId = loadU32(data);
+    state.toMove = data[4];
+    state.over = data[5];
+    state.bagSize = data[6];
+    state.scores[0] = static_cast<int32_t>(loadU32(data + 7));
+    state.scores[1] = static_cast<int32_t>(loadU32(data + 11));
+    state.rackSize = data[15];
+    std::memcpy(state.rack, data + 16, sizeof(state.rack));
+    std::memcpy(state.board, data + 16 + sizeof(state.rack), sizeof(state.board));
+    return state.rackSize <= Rules::RACK_SIZE && state.toMove < 2;
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+#include "../Core/Match.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+enum class MessageType : uint8_t {
+    // client -> server
+    CREATE = 0x01,      // u32 seed                       -> SEATED as seat 0
+    JOIN = 0x02,        // u32 match id                   -> SEATED as seat 1, STATE to both
+    PLAY = 0x03,        // u8 count, count x (u8 square, u8 tile)
+    PASS = 0x04,
+    RESIGN = 0x05,
+    // server -> client
+    SEATED = 0x81,      // u32 match id, u8 seat
+    RESULT = 0x82,      // u8 request type, u8 status, i16 score
+    STATE = 0x83        // see MatchState
+};
+
+// What one seat sees after every change: its own rack and the shared board.
+// Tiles use the saved-game encoding (0 empty, else letter | BLANK_BIT).
+struct MatchState {
+    uint32_t matchId;
+    uint8_t toMove;
+    uint8_t over;
+    uint8_t bagSize;
+    int32_t scores[2];
+    uint8_t rackSize;
+    uint8_t rack[Rules::RACK_SIZE];
+    uint8_t board[Rules::BOARD_SIZE * Rules::BOARD_SIZE];
+};
+
+// Frames are a little-endian u32 payload length followed by the payload,
+// whose first byte is the MessageType. The same helpers build and read
+// frames on both ends, so the server and the load generator cannot drift.
+struct Protocol {
+    static const size_t HEADER_BYTES = 4;
+    static const uint32_t MAX_PAYLOAD = 1024;
+    static const size_t STATE_PAYLOAD = 1 + 4 + 3 + 8 + 1 + Rules::RACK_SIZE + Rules::BOARD_SIZE * Rules::BOARD_SIZE;
+
+    // RESULT statuses past the MoveStatus values
+    static const uint8_t STATUS_BAD_REQUEST = 0x10;
+    static const uint8_t STATUS_NO_MATCH = 0x11;     // unknown or full match, or not seated
+    static const uint8_t STATUS_WAITING = 0x12;      // the second seat is still empty
+
+    // Size of the whole frame at the front of `data`: 0 while incomplete,
+    // SIZE_MAX when the announced payload is empty or over MAX_PAYLOAD.
+    static size_t frameSize(const uint8_t* data, size_t size);
+
+    static void appendCreate(std::vector<uint8_t>& out, uint32_t seed);
+    static void appendJoin(std::vector<uint8_t>& out, uint32_t matchId);
+    static void appendPlay(std::vector<uint8_t>& out, const std::vector<PlacedTile>& tiles);
+    static void appendRequest(std::vector<uint8_t>& out, MessageType type);
+
+    static void appendSeated(std::vector<uint8_t>& out, uint32_t matchId, uint8_t seat);
+    static void appendResult(std::vector<uint8_t>& out, MessageType request, uint8_t status, int score);
+    static void appendState(std::vector<uint8_t>& out, uint32_t matchId, const Match& match, int seat);
+
+    // `payload` excludes the length header and includes the type byte.
+    static bool parseId(const uint8_t* payload, size_t size, uint32_t& value);
+    static bool parsePlay(const uint8_t* payload, size_t size, std::vector<PlacedTile>& tiles);
+    static bool parseSeated(const uint8_t* payload, size_t size, uint32_t& matchId, uint8_t& seat);
+    static bool parseResult(const uint8_t* payload, size_t size, MessageType& request, uint8_t& status, int& score);
+    static bool parseState(const uint8_t* payload, size_t size, MatchState& state);
+};
\ No newline at end of file
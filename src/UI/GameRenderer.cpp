@@ -1,8 +1,10 @@
 #include "GameRenderer.hpp"
-#include <iostream>
+#include "../Core/Logger.hpp"
+#include "../Core/Trace.hpp"
 #include <vector>
 #include <cmath>
 #include <algorithm>
+#include <cstdio>
 
 // === STATIC COLOR DEFINITIONS ===
 const SDL_Color GameRenderer::BOARD_COLOR = {139, 69, 19, 255};      // Brown
@@ -32,7 +34,7 @@ struct Particle {
 static bool tutorialVisible = false;
 static bool tutorialAnimating = false;
 static float tutorialAnimationTimer = 0.0f;
-static Uint64 tutorialAnimationStart = 0;
+static double tutorialAnimationStart = -1.0;   // < 0: start on the next frame
 const float TUTORIAL_ANIMATION_DURATION = 0.5f; 
 
 
@@ -43,11 +45,16 @@ static const int NORMAL_FONT_SIZE = 18;
 static const int SMALL_FONT_SIZE = 14;
 
 GameRenderer::GameRenderer(SDL_Renderer* renderer, SDL_Window* window) 
-    : renderer(renderer), window(window), font(nullptr), smallFont(nullptr), titleFont(nullptr) {
+    : renderer(renderer), window(window), font(nullptr), smallFont(nullptr), titleFont(nullptr),
+      specialFont(nullptr), boardLayer(nullptr), boardLayerValid(false), boardLayerFailed(false),
+      tileSpritesFailed(false), animationTime(0.0), menuStartTime(-1.0), pauseStartTime(-1.0),
+      gameOverStartTime(-1.0), frameCounters{0, 0, 0}, lastFrameCounters{0, 0, 0}, textUploadsSeen(0) {
     initializeFonts();
 }
 
 GameRenderer::~GameRenderer() {
+    destroyBoardLayer();
+    tileSprites.invalidate();
     cleanupFonts();
 }
 
@@ -59,6 +66,12 @@ bool GameRenderer::initializeFonts() {
 }
 
 void GameRenderer::cleanupFonts() {
+    textCache.clear();
+    fontAtlas.destroy();
+    smallFontAtlas.destroy();
+    titleFontAtlas.destroy();
+    specialFontAtlas.destroy();
+
     if (font) {
         TTF_CloseFont(font);
         font = nullptr;
@@ -78,26 +91,111 @@ void GameRenderer::cleanupFonts() {
     TTF_Quit();
 }
 
-void GameRenderer::renderGameState(const Game& game) {
+void GameRenderer::renderGameState(const GameSnapshot& snapshot) {
+    TRACE_SCOPE("GameRenderer::renderGameState");
     clear();    
-    renderBoard(game.getBoard());
-    renderPickedTiles(game);
-    renderSelectedTileIndicator(game);
-    renderPlayerRacks(game.getPlayer1(), game.getPlayer2(), game.getCurrentPlayerIndex());
-    renderPlayerInfo(game.getPlayer1(), game.getPlayer2(), game.getCurrentPlayerIndex());
-    renderCurrentWordScore(game);
+    renderBoard(snapshot.board);
+    renderPickedTiles(snapshot);
+    renderSelectedTileIndicator(snapshot);
+    renderPlayerRacks(snapshot.player1, snapshot.player2, snapshot.currentPlayerIndex);
+    renderPlayerInfo(snapshot.player1, snapshot.player2, snapshot.currentPlayerIndex);
+    renderCurrentWordScore(snapshot);
     renderPauseButton();
     present();
 }
 
 void GameRenderer::renderBoard(const Board& board) {
-    renderGrid();
-    renderSpecialSquares(board);
+    TRACE_SCOPE("GameRenderer::renderBoard");
+    if (boardLayerValid || buildBoardLayer(board)) {
+        const SDL_FRect layerRect = {
+            static_cast<float>(BOARD_OFFSET_X - 1), static_cast<float>(BOARD_OFFSET_Y - 1),
+            static_cast<float>(BOARD_SIZE * CELL_SIZE + 2), static_cast<float>(BOARD_SIZE * CELL_SIZE + 2)
+        };
+        batch.addTexture(RenderLayer::BOARD, boardLayer, nullptr, layerRect);
+    } else {
+        renderGrid(static_cast<float>(BOARD_OFFSET_X), static_cast<float>(BOARD_OFFSET_Y));
+        renderSpecialSquares(board, static_cast<float>(BOARD_OFFSET_X), static_cast<float>(BOARD_OFFSET_Y));
+    }
     renderTiles(board);
 }
 
-void GameRenderer::renderPickedTiles(const Game& game) {
-    const auto& currentWord = game.getCurrentWord();
+bool GameRenderer::buildBoardLayer(const Board& board) {
+    if (boardLayerFailed) return false;
+    flushBatch();
+
+    // One pixel of margin on each side for the outer grid line
+    const int layerSize = BOARD_SIZE * CELL_SIZE + 2;
+    if (!boardLayer) {
+        boardLayer = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                       layerSize, layerSize);
+        if (!boardLayer) {
+            LOG_WARN("Board layer unavailable, drawing the board directly: " << SDL_GetError());
+            boardLayerFailed = true;
+            return false;
+        }
+        SDL_SetTextureBlendMode(boardLayer, SDL_BLENDMODE_NONE);
+    }
+
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+    if (!SDL_SetRenderTarget(renderer, boardLayer)) {
+        return false;
+    }
+
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+    SDL_RenderClear(renderer);
+    renderGrid(1.0f, 1.0f);
+    renderSpecialSquares(board, 1.0f, 1.0f);
+
+    SDL_SetRenderTarget(renderer, previousTarget);
+    boardLayerValid = true;
+    ++frameCounters.textureUploads;
+    return true;
+}
+
+void GameRenderer::destroyBoardLayer() {
+    if (boardLayer) {
+        SDL_DestroyTexture(boardLayer);
+        boardLayer = nullptr;
+    }
+    boardLayerValid = false;
+}
+
+void GameRenderer::invalidateBoardLayer() {
+    // Target contents may be lost on resize or a backend reset; redraw on next use
+    destroyBoardLayer();
+    boardLayerFailed = false;
+}
+
+void GameRenderer::invalidateRenderTargets() {
+    batch.discard();
+    invalidateBoardLayer();
+    tileSprites.invalidate();
+    tileSpritesFailed = false;
+}
+
+void GameRenderer::recreateDeviceTextures() {
+    invalidateRenderTargets();
+    buildGlyphAtlases();
+}
+
+void GameRenderer::invalidateScoreText() {
+    textCache.invalidateGroup(TextGroup::SCORES);
+}
+
+void GameRenderer::advanceAnimation(double seconds) {
+    animationTime += seconds;
+}
+
+float GameRenderer::getScreenElapsedTime(double& startTime) {
+    if (startTime < 0.0) {
+        startTime = animationTime;
+    }
+    return static_cast<float>(animationTime - startTime);
+}
+
+void GameRenderer::renderPickedTiles(const GameSnapshot& snapshot) {
+    TRACE_SCOPE("GameRenderer::renderPickedTiles");
+    const auto& currentWord = snapshot.getCurrentWord();
     
     for (const auto& placement : currentWord) {
         int row = placement.row;
@@ -106,43 +204,37 @@ void GameRenderer::renderPickedTiles(const Game& game) {
         
         if (tile) {
             const SDL_FRect cellRect = getBoardCellRect(row, col);
-            SDL_SetRenderDrawColor(renderer, YELLOW_COLOR.r, YELLOW_COLOR.g, YELLOW_COLOR.b, YELLOW_COLOR.a);
-            const SDL_FRect highlightRect = {
-                cellRect.x - 2.0f, cellRect.y - 2.0f, 
-                cellRect.w + 4.0f, cellRect.h + 4.0f
-            };
-            SDL_RenderFillRect(renderer, &highlightRect);
-            
-            renderTile(cellRect.x, cellRect.y, tile);
+            renderTile(cellRect.x, cellRect.y, tile, TileSpriteState::PENDING, RenderLayer::TILES);
         }
     }
 }
 
-void GameRenderer::renderSelectedTileIndicator(const Game& game) {
-    if (game.getGameState() != GameState::PLAYING && game.getGameState() != GameState::PLACING_TILES) {
-        std::cout << "Wrong game state, returning early" << std::endl;
+void GameRenderer::renderSelectedTileIndicator(const GameSnapshot& snapshot) {
+    TRACE_SCOPE("GameRenderer::renderSelectedTileIndicator");
+    if (snapshot.gameState != GameState::PLAYING && snapshot.gameState != GameState::PLACING_TILES) {
+        LOG_TRACE("Wrong game state, returning early");
         return;
     }
     
-    const Player& currentPlayer = (game.getCurrentPlayerIndex() == 0) ? game.getPlayer1() : game.getPlayer2();
+    const Player& currentPlayer = snapshot.getCurrentPlayer();
     const auto& rack = currentPlayer.getRack();
-    int selectedIndex = game.getSelectedTileIndex();
+    int selectedIndex = snapshot.selectedTileIndex;
 
     
     if (!rack.empty() && selectedIndex >= 0 && selectedIndex < static_cast<int>(rack.size())) {}
     
     if (rack.empty()) {
-        std::cout << "ISSUE: Rack is empty" << std::endl;
+        LOG_DEBUG("ISSUE: Rack is empty");
         return;
     }
     
     if (selectedIndex < 0) {
-        std::cout << "ISSUE: Selected index is negative: " << selectedIndex << std::endl;
+        LOG_DEBUG("ISSUE: Selected index is negative: " << selectedIndex);
         return;
     }
     
     if (selectedIndex >= static_cast<int>(rack.size())) {
-        std::cout << "ISSUE: Selected index out of bounds: " << selectedIndex << " >= " << rack.size() << std::endl;
+        LOG_DEBUG("ISSUE: Selected index out of bounds: " << selectedIndex << " >= " << rack.size());
         return;
     }
     
@@ -163,27 +255,12 @@ void GameRenderer::renderSelectedTileIndicator(const Game& game) {
     const float centerOffset = (totalRackWidth - actualRackWidth) / 2.0f;
     
     const float selectedTileX = rackStartX + centerOffset + static_cast<float>(selectedIndex) * TILE_SPACING;
-    SDL_SetRenderDrawColor(renderer, 255, 215, 0, 180); // Bright gold
-    for (int i = 0; i < 3; i++) {
-        const SDL_FRect glowRect = {
-            selectedTileX - 3.0f - i, rackY - 3.0f - i,
-            CELL_SIZE + 6.0f + 2*i, CELL_SIZE + 6.0f + 2*i
-        };
-        SDL_RenderRect(renderer, &glowRect);
-    }
-    
-    SDL_SetRenderDrawColor(renderer, 255, 140, 0, 255); // Dark orange
-    for (int i = 0; i < 2; i++) {
-        const SDL_FRect innerBorder = {
-            selectedTileX - 1.0f - i, rackY - 1.0f - i,
-            CELL_SIZE + 2.0f + 2*i, CELL_SIZE + 2.0f + 2*i
-        };
-        SDL_RenderRect(renderer, &innerBorder);
-    }
+    renderTile(selectedTileX, rackY, &rack[selectedIndex], TileSpriteState::SELECTED, RenderLayer::OVERLAY);
 }
 
-void GameRenderer::renderTilePreview(const Game& game, int mouseX, int mouseY) {
-    if (game.getGameState() != GameState::PLAYING && game.getGameState() != GameState::PLACING_TILES) {
+void GameRenderer::renderTilePreview(const GameSnapshot& snapshot, int mouseX, int mouseY) {
+    TRACE_SCOPE("GameRenderer::renderTilePreview");
+    if (snapshot.gameState != GameState::PLAYING && snapshot.gameState != GameState::PLACING_TILES) {
         return;
     }
     
@@ -191,13 +268,13 @@ void GameRenderer::renderTilePreview(const Game& game, int mouseX, int mouseY) {
     if (!isPointInBoard(mouseX, mouseY, row, col)) {
         return;
     }
-    if (game.getBoard().getTile(row, col) != nullptr) {
+    if (snapshot.board.getTile(row, col) != nullptr) {
         return;
     }
     
-    const Player& currentPlayer = (game.getCurrentPlayerIndex() == 0) ? game.getPlayer1() : game.getPlayer2();
+    const Player& currentPlayer = snapshot.getCurrentPlayer();
     const auto& rack = currentPlayer.getRack();
-    int selectedIndex = game.getSelectedTileIndex();
+    int selectedIndex = snapshot.selectedTileIndex;
     
     if (rack.empty() || selectedIndex < 0 || selectedIndex >= static_cast<int>(rack.size())) {
         return;
@@ -205,43 +282,39 @@ void GameRenderer::renderTilePreview(const Game& game, int mouseX, int mouseY) {
     
     const SDL_FRect cellRect = getBoardCellRect(row, col);
     
-    SDL_SetRenderDrawColor(renderer, 200, 255, 200, 120);
-    SDL_RenderFillRect(renderer, &cellRect);
+    batch.addRect(RenderLayer::TILES, cellRect, {200, 255, 200, 120});
     
-    SDL_SetRenderDrawColor(renderer, 0, 200, 0, 180);
     for (int i = 0; i < 2; i++) {
         const SDL_FRect borderRect = {
             cellRect.x - i, cellRect.y - i,
             cellRect.w + 2*i, cellRect.h + 2*i
         };
-        SDL_RenderRect(renderer, &borderRect);
+        batch.addRectOutline(RenderLayer::TILES, borderRect, {0, 200, 0, 180});
     }
     
     const Tile& selectedTile = rack[selectedIndex];
     
-    SDL_SetRenderDrawColor(renderer, TILE_COLOR.r, TILE_COLOR.g, TILE_COLOR.b, 180);
     const SDL_FRect tileRect = {cellRect.x + 4.0f, cellRect.y + 4.0f, cellRect.w - 8.0f, cellRect.h - 8.0f};
-    SDL_RenderFillRect(renderer, &tileRect);
-    
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
-    SDL_RenderRect(renderer, &tileRect);
+    batch.addRect(RenderLayer::TILES, tileRect, {TILE_COLOR.r, TILE_COLOR.g, TILE_COLOR.b, 180});
+    batch.addRectOutline(RenderLayer::TILES, tileRect, {0, 0, 0, 180});
     
     const std::string letter(1, selectedTile.getLetter());
     float letterX = cellRect.x + (cellRect.w / 2.0f) - 7.0f;
     float letterY = cellRect.y + 7.0f;
     
     SDL_Color fadedColor = {TEXT_COLOR.r, TEXT_COLOR.g, TEXT_COLOR.b, 180};
-    renderText(letter, letterX, letterY, fadedColor, font);
+    queueText(RenderLayer::UI, letter, letterX, letterY, fadedColor, font);
     
     const std::string points = std::to_string(selectedTile.getPoints());
     float pointsX = cellRect.x + cellRect.w - 15.0f;
     float pointsY = cellRect.y + cellRect.h - 18.0f;
-    renderText(points, pointsX, pointsY, fadedColor, smallFont);
+    queueText(RenderLayer::UI, points, pointsX, pointsY, fadedColor, smallFont);
     
-    renderText("PREVIEW", cellRect.x - 20.0f, cellRect.y - 20.0f, GREEN_COLOR, smallFont);
+    queueText(RenderLayer::UI, "PREVIEW", cellRect.x - 20.0f, cellRect.y - 20.0f, GREEN_COLOR, smallFont);
 }
 
 void GameRenderer::renderPlayerRacks(const Player& player1, const Player& player2, int currentPlayer) {
+    TRACE_SCOPE("GameRenderer::renderPlayerRacks");
     const float boardWidth = BOARD_SIZE * CELL_SIZE;
     const float boardHeight = BOARD_SIZE * CELL_SIZE;
     
@@ -255,6 +328,7 @@ void GameRenderer::renderPlayerRacks(const Player& player1, const Player& player
 }
 
 void GameRenderer::renderPlayerInfo(const Player& player1, const Player& player2, int currentPlayer) {
+    TRACE_SCOPE("GameRenderer::renderPlayerInfo");
     const float boardWidth = BOARD_SIZE * CELL_SIZE;
     const float rightSideX = BOARD_OFFSET_X + boardWidth + PLAYER_INFO_PADDING;
     
@@ -285,11 +359,9 @@ void GameRenderer::renderPlayerInfo(const Player& player1, const Player& player2
         buttonWidth, 
         buttonHeight
     };
-    SDL_SetRenderDrawColor(renderer, 100, 149, 237, 255); // Blue
-    SDL_RenderFillRect(renderer, &switchButton);
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-    SDL_RenderRect(renderer, &switchButton);
-    renderText("SWITCH", switchButton.x + 2, switchButton.y + 8, BLACK_COLOR, smallFont);
+    batch.addRect(RenderLayer::BACKGROUND, switchButton, {100, 149, 237, 255}); // Blue
+    batch.addRectOutline(RenderLayer::UI, switchButton, BLACK_COLOR);
+    queueText(RenderLayer::UI, "SWITCH", switchButton.x + 2, switchButton.y + 8, BLACK_COLOR, smallFont);
     
     const SDL_FRect submitButton = {
         rightSideX + buttonWidth + buttonGap, 
@@ -297,11 +369,9 @@ void GameRenderer::renderPlayerInfo(const Player& player1, const Player& player2
         buttonWidth, 
         buttonHeight
     };
-    SDL_SetRenderDrawColor(renderer, 34, 197, 94, 255); // Green
-    SDL_RenderFillRect(renderer, &submitButton);
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-    SDL_RenderRect(renderer, &submitButton);
-    renderText("SUBMIT", submitButton.x + 2, submitButton.y + 8, BLACK_COLOR, smallFont);
+    batch.addRect(RenderLayer::BACKGROUND, submitButton, {34, 197, 94, 255}); // Green
+    batch.addRectOutline(RenderLayer::UI, submitButton, BLACK_COLOR);
+    queueText(RenderLayer::UI, "SUBMIT", submitButton.x + 2, submitButton.y + 8, BLACK_COLOR, smallFont);
     
     const SDL_FRect cancelButton = {
         rightSideX + 2 * (buttonWidth + buttonGap), 
@@ -309,11 +379,9 @@ void GameRenderer::renderPlayerInfo(const Player& player1, const Player& player2
         buttonWidth, 
         buttonHeight
     };
-    SDL_SetRenderDrawColor(renderer, 239, 68, 68, 255); // Red
-    SDL_RenderFillRect(renderer, &cancelButton);
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-    SDL_RenderRect(renderer, &cancelButton);
-    renderText("CANCEL", cancelButton.x + 2, cancelButton.y + 8, BLACK_COLOR, smallFont);
+    batch.addRect(RenderLayer::BACKGROUND, cancelButton, {239, 68, 68, 255}); // Red
+    batch.addRectOutline(RenderLayer::UI, cancelButton, BLACK_COLOR);
+    queueText(RenderLayer::UI, "CANCEL", cancelButton.x + 2, cancelButton.y + 8, BLACK_COLOR, smallFont);
 }
 
 bool GameRenderer::isPointInSwitchTurnButton(int x, int y) const {
@@ -355,8 +423,9 @@ bool GameRenderer::isPointInCancelButton(int x, int y) const {
             y >= buttonStartY && y <= buttonStartY + buttonHeight);
 }
 
-void GameRenderer::renderCurrentWordScore(const Game& game) {
-    const auto& currentWord = game.getCurrentWord();
+void GameRenderer::renderCurrentWordScore(const GameSnapshot& snapshot) {
+    TRACE_SCOPE("GameRenderer::renderCurrentWordScore");
+    const auto& currentWord = snapshot.getCurrentWord();
     if (currentWord.empty()) return;
 
     std::string completeWord = "";
@@ -384,7 +453,7 @@ void GameRenderer::renderCurrentWordScore(const Game& game) {
         int startCol = positions[0].second;
         int endCol = positions.back().second;
         
-        const Board& board = game.getBoard();
+        const Board& board = snapshot.board;
         while (startCol > 0 && board.getTile(row, startCol - 1) != nullptr) {
             startCol--;
         }
@@ -436,7 +505,7 @@ void GameRenderer::renderCurrentWordScore(const Game& game) {
         int startRow = positions[0].first;
         int endRow = positions.back().first;
         
-        const Board& board = game.getBoard();
+        const Board& board = snapshot.board;
         while (startRow > 0 && board.getTile(startRow - 1, col) != nullptr) {
             startRow--;
         }
@@ -491,14 +560,14 @@ void GameRenderer::renderCurrentWordScore(const Game& game) {
         const float infoX = 20.0f;
         const float infoY = 20.0f;
         
-        renderText("Building: " + completeWord, infoX, infoY, BLACK_COLOR, font);
+        queueText(RenderLayer::UI, "Building: " + completeWord, infoX, infoY, BLACK_COLOR, font, TextGroup::SCORES);
         
         std::string scoreText = "Preview Score: " + std::to_string(totalScore);
         if (wordMultiplier > 1) {
             scoreText += " (x" + std::to_string(wordMultiplier) + " word bonus)";
         }
         
-        renderText(scoreText, infoX, infoY + 25.0f, BLUE_COLOR, smallFont);
+        queueText(RenderLayer::UI, scoreText, infoX, infoY + 25.0f, BLUE_COLOR, smallFont, TextGroup::SCORES);
     }
 }
 
@@ -506,13 +575,9 @@ void GameRenderer::renderScores(const Player& player1, const Player& player2) {
 }
 
 void GameRenderer::renderGameStart() {
-    static Uint64 startTime = 0;
-    if (startTime == 0) {
-        startTime = SDL_GetTicks();
-    }
-    
-    Uint64 currentTime = SDL_GetTicks();
-    float elapsedTime = (currentTime - startTime) / 1000.0f;
+    TRACE_SCOPE("GameRenderer::renderGameStart");
+    flushBatch();
+    float elapsedTime = getScreenElapsedTime(menuStartTime);
     
     SDL_SetRenderDrawColor(renderer, 30, 60, 120, 255);
     SDL_RenderClear(renderer);
@@ -539,44 +604,40 @@ void GameRenderer::renderGameStart() {
 }
 
 void GameRenderer::renderMenu() {
+    TRACE_SCOPE("GameRenderer::renderMenu");
     renderMenuBackground();
     renderMenuContent();
 }
 
 void GameRenderer::renderPauseButton() {
+    TRACE_SCOPE("GameRenderer::renderPauseButton");
     const float buttonX = WINDOW_WIDTH - PAUSE_BUTTON_SIZE - PAUSE_BUTTON_MARGIN;
     const float buttonY = PAUSE_BUTTON_MARGIN;
     
-    SDL_SetRenderDrawColor(renderer, 60, 60, 60, 220);
     const SDL_FRect buttonRect = {buttonX, buttonY, PAUSE_BUTTON_SIZE, PAUSE_BUTTON_SIZE};
-    SDL_RenderFillRect(renderer, &buttonRect);
+    batch.addRect(RenderLayer::BACKGROUND, buttonRect, {60, 60, 60, 220});
     
-    SDL_SetRenderDrawColor(renderer, 200, 200, 200, 255);
     for (int i = 0; i < 2; i++) {
         const SDL_FRect borderRect = {
             buttonX - i, buttonY - i,
             PAUSE_BUTTON_SIZE + 2*i, PAUSE_BUTTON_SIZE + 2*i
         };
-        SDL_RenderRect(renderer, &borderRect);
+        batch.addRectOutline(RenderLayer::UI, borderRect, {200, 200, 200, 255});
     }
     
-    SDL_SetRenderDrawColor(renderer, WHITE_COLOR.r, WHITE_COLOR.g, WHITE_COLOR.b, WHITE_COLOR.a);
     const SDL_FRect bar1 = {buttonX + 10, buttonY + 6, 8, 28};
     const SDL_FRect bar2 = {buttonX + 22, buttonY + 6, 8, 28};
-    SDL_RenderFillRect(renderer, &bar1);
-    SDL_RenderFillRect(renderer, &bar2);
+    batch.addRect(RenderLayer::UI, bar1, WHITE_COLOR);
+    batch.addRect(RenderLayer::UI, bar2, WHITE_COLOR);
     
-    renderText("PAUSE", buttonX - 5, buttonY + PAUSE_BUTTON_SIZE + 5, BLACK_COLOR, smallFont);
+    queueText(RenderLayer::UI, "PAUSE", buttonX - 5, buttonY + PAUSE_BUTTON_SIZE + 5, BLACK_COLOR, smallFont);
 }
 
 void GameRenderer::renderPauseMenu() {
-    static Uint64 startTime = 0;
-    if (startTime == 0) {
-        startTime = SDL_GetTicks();
-    }
-    
-    Uint64 currentTime = SDL_GetTicks();
-    float elapsedTime = (currentTime - startTime) / 1000.0f;
+    TRACE_SCOPE("GameRenderer::renderPauseMenu");
+    // Full-screen overlays go over everything queued so far
+    flushBatch();
+    float elapsedTime = getScreenElapsedTime(pauseStartTime);
     
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
     const SDL_FRect overlay = {0.0f, 0.0f, static_cast<float>(WINDOW_WIDTH), static_cast<float>(WINDOW_HEIGHT)};
@@ -647,13 +708,10 @@ PauseMenuOption GameRenderer::getPauseMenuOption(int x, int y) const {
 }
 
 void GameRenderer::renderGameOver(const Player& player1, const Player& player2) {
-    static Uint64 startTime = 0;
-    if (startTime == 0) {
-        startTime = SDL_GetTicks();
-    }
-    
-    Uint64 currentTime = SDL_GetTicks();
-    float elapsedTime = (currentTime - startTime) / 1000.0f;
+    TRACE_SCOPE("GameRenderer::renderGameOver");
+    // Full-screen overlays go over everything queued so far
+    flushBatch();
+    float elapsedTime = getScreenElapsedTime(gameOverStartTime);
     
     SDL_SetRenderDrawColor(renderer, 20, 30, 60, 255);
     SDL_RenderClear(renderer);
@@ -679,6 +737,9 @@ void GameRenderer::renderGameOver(const Player& player1, const Player& player2)
 }
 
 void GameRenderer::renderPauseScreen() {
+    TRACE_SCOPE("GameRenderer::renderPauseScreen");
+    // Full-screen overlays go over everything queued so far
+    flushBatch();
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 150);
     const SDL_FRect overlay = {0.0f, 0.0f, static_cast<float>(WINDOW_WIDTH), static_cast<float>(WINDOW_HEIGHT)};
     SDL_RenderFillRect(renderer, &overlay);
@@ -698,12 +759,76 @@ void GameRenderer::renderPauseScreen() {
 void GameRenderer::clear() {
     SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
     SDL_RenderClear(renderer);
+    frameCounters = {0, 0, 0};
 }
 
 void GameRenderer::present() {
+    TRACE_SCOPE("GameRenderer::present");
+    flushBatch();
+
+    // Text rasters are created inside the cache, so count them by difference
+    const size_t textUploads = textCache.getTextureUploads();
+    frameCounters.textureUploads += textUploads - textUploadsSeen;
+    textUploadsSeen = textUploads;
+    lastFrameCounters = frameCounters;
+
     SDL_RenderPresent(renderer);
 }
 
+void GameRenderer::flushBatch() {
+    if (!batch.isEmpty()) {
+        batch.flush(renderer);
+        frameCounters.drawCalls += batch.getLastDrawCalls();
+        frameCounters.quads += batch.getLastQuadCount();
+    }
+    textCache.releasePending();
+}
+
+RenderCounters GameRenderer::getLastFrameCounters() const {
+    return lastFrameCounters;
+}
+
+void GameRenderer::renderPerfHud(const PerfHudStats& stats) {
+    TRACE_SCOPE("GameRenderer::renderPerfHud");
+    // Readouts change on every refresh; the previous set was already drawn
+    textCache.invalidateGroup(TextGroup::HUD);
+
+    const MoveGenerationStats& moves = stats.moveGeneration;
+    char lines[8][80];
+    std::snprintf(lines[0], sizeof(lines[0]), "Frame %.1f / %.1f / %.1f ms%s", stats.frameTime.p50Ms,
+                  stats.frameTime.p95Ms, stats.frameTime.p99Ms, stats.vsync ? " vsync" : "");
+    std::snprintf(lines[1], sizeof(lines[1]), "Render %.2f / %.2f ms", stats.renderTime.p50Ms,
+                  stats.renderTime.p99Ms);
+    std::snprintf(lines[2], sizeof(lines[2]), "Draw calls %llu  Quads %llu",
+                  static_cast<unsigned long long>(stats.lastFrame.drawCalls),
+                  static_cast<unsigned long long>(stats.lastFrame.quads));
+    std::snprintf(lines[3], sizeof(lines[3]), "Texture uploads %llu",
+                  static_cast<unsigned long long>(stats.lastFrame.textureUploads));
+    if (moves.totalMoves > 0) {
+        std::snprintf(lines[4], sizeof(lines[4]), "AI move gen %.2f ms", moves.lastMillis);
+    } else {
+        std::snprintf(lines[4], sizeof(lines[4]), "AI move gen n/a");
+    }
+    std::snprintf(lines[5], sizeof(lines[5]), "Moves generated %llu (last %llu)",
+                  static_cast<unsigned long long>(moves.totalMoves),
+                  static_cast<unsigned long long>(moves.lastMoves));
+    std::snprintf(lines[6], sizeof(lines[6]), "Lookups %.0f/s", stats.lookupsPerSecond);
+    if (stats.residentBytes > 0) {
+        std::snprintf(lines[7], sizeof(lines[7]), "Resident %.1f MB", stats.residentBytes / (1024.0 * 1024.0));
+    } else {
+        std::snprintf(lines[7], sizeof(lines[7]), "Resident n/a");
+    }
+
+    const float lineHeight = 18.0f;
+    const SDL_FRect panel = {WINDOW_WIDTH - 300.0f, 80.0f, 280.0f, 8 * lineHeight + 16.0f};
+    batch.addRect(RenderLayer::OVERLAY, panel, {30, 30, 30, 255});
+    batch.addRectOutline(RenderLayer::OVERLAY, panel, {90, 90, 90, 255});
+    for (int i = 0; i < 8; ++i) {
+        queueText(RenderLayer::OVERLAY, lines[i], panel.x + 10.0f, panel.y + 8.0f + i * lineHeight,
+                  GREEN_COLOR, smallFont, TextGroup::HUD);
+    }
+}
+
 SDL_FRect GameRenderer::getBoardCellRect(int row, int col) const {
     return {
         static_cast<float>(BOARD_OFFSET_X + col * CELL_SIZE + 1),
@@ -713,6 +838,11 @@ SDL_FRect GameRenderer::getBoardCellRect(int row, int col) const {
     };
 }
 
+SDL_Rect GameRenderer::getBoardBounds() {
+    // Includes the outer grid line drawn one pixel outside the cells
+    return {BOARD_OFFSET_X - 1, BOARD_OFFSET_Y - 1, BOARD_SIZE * CELL_SIZE + 2, BOARD_SIZE * CELL_SIZE + 2};
+}
+
 bool GameRenderer::isPointInBoard(int x, int y, int& row, int& col) const {
     if (x < BOARD_OFFSET_X || y < BOARD_OFFSET_Y ||
         x >= BOARD_OFFSET_X + BOARD_SIZE * CELL_SIZE ||
@@ -726,38 +856,38 @@ bool GameRenderer::isPointInBoard(int x, int y, int& row, int& col) const {
     return col >= 0 && col < BOARD_SIZE && row >= 0 && row < BOARD_SIZE;
 }
 
-void GameRenderer::renderGrid() {
+void GameRenderer::renderGrid(float originX, float originY) {
     SDL_SetRenderDrawColor(renderer, 101, 67, 33, 255);
     
     for (int i = 0; i <= BOARD_SIZE; i++) {
-        const float x = static_cast<float>(BOARD_OFFSET_X + i * CELL_SIZE);
-        const float y1 = static_cast<float>(BOARD_OFFSET_Y);
-        const float y2 = static_cast<float>(BOARD_OFFSET_Y + BOARD_SIZE * CELL_SIZE);
+        const float x = originX + static_cast<float>(i * CELL_SIZE);
+        const float y1 = originY;
+        const float y2 = originY + static_cast<float>(BOARD_SIZE * CELL_SIZE);
         SDL_RenderLine(renderer, x, y1, x, y2);
     }
     
     for (int i = 0; i <= BOARD_SIZE; i++) {
-        const float y = static_cast<float>(BOARD_OFFSET_Y + i * CELL_SIZE);
-        const float x1 = static_cast<float>(BOARD_OFFSET_X);
-        const float x2 = static_cast<float>(BOARD_OFFSET_X + BOARD_SIZE * CELL_SIZE);
+        const float y = originY + static_cast<float>(i * CELL_SIZE);
+        const float x1 = originX;
+        const float x2 = originX + static_cast<float>(BOARD_SIZE * CELL_SIZE);
         SDL_RenderLine(renderer, x1, y, x2, y);
     }
 }
 
-void GameRenderer::renderSpecialSquares(const Board& board) {
+void GameRenderer::renderSpecialSquares(const Board& board, float originX, float originY) {
     for (int row = 0; row < BOARD_SIZE; row++) {
         for (int col = 0; col < BOARD_SIZE; col++) {
             SpecialSquare special = board.getSpecialSquare(row, col);
             if (special != SpecialSquare::NORMAL) {
-                renderSingleSpecialSquare(row, col, special);
+                renderSingleSpecialSquare(row, col, special, originX, originY);
             }
         }
     }
 }
 
-void GameRenderer::renderSingleSpecialSquare(int row, int col, SpecialSquare special) {
-    const float x = static_cast<float>(BOARD_OFFSET_X + col * CELL_SIZE);
-    const float y = static_cast<float>(BOARD_OFFSET_Y + row * CELL_SIZE);
+void GameRenderer::renderSingleSpecialSquare(int row, int col, SpecialSquare special, float originX, float originY) {
+    const float x = originX + static_cast<float>(col * CELL_SIZE);
+    const float y = originY + static_cast<float>(row * CELL_SIZE);
     
     const SDL_Color color = SPECIAL_SQUARE_COLORS[static_cast<int>(special)];
     SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
@@ -802,56 +932,110 @@ void GameRenderer::renderSpecialSquareText(float x, float y, SpecialSquare speci
 }
 
 void GameRenderer::renderTiles(const Board& board) {
+    TRACE_SCOPE("GameRenderer::renderTiles");
     for (int row = 0; row < BOARD_SIZE; row++) {
         for (int col = 0; col < BOARD_SIZE; col++) {
             const Tile* tile = board.getTile(row, col);
             if (tile) {
                 const SDL_FRect cellRect = getBoardCellRect(row, col);
-                renderTile(cellRect.x, cellRect.y, tile);
+                renderTile(cellRect.x, cellRect.y, tile, TileSpriteState::PLACED, RenderLayer::TILES);
             }
         }
     }
 }
 
-void GameRenderer::renderTile(float x, float y, const Tile* tile) {
+void GameRenderer::renderTile(float x, float y, const Tile* tile, TileSpriteState state, RenderLayer layer) {
     if (!tile) return;
-    
+
+    const char letter = tile->getLetter();
+    const int points = tile->getPoints();
+    const bool blank = tile->getIsBlank() || points == 0;
+
+    if (!tileSprites.isReady() && !tileSpritesFailed) {
+        tileSpritesFailed = !buildTileSprites();
+    }
+    SDL_FRect source, dest;
+    if (tileSprites.locate(x, y, letter, points, blank, state, source, dest)) {
+        batch.addTexture(layer, tileSprites.getTexture(), &source, dest);
+        return;
+    }
+    renderTileSprite(x, y, letter, points, state, layer);
+}
+
+bool GameRenderer::buildTileSprites() {
+    // The sprites bake in text, so wait for the glyph atlases
+    if (!fontAtlas.isReady() || !smallFontAtlas.isReady()) {
+        return false;
+    }
+    // Anything already queued belongs on screen, not in the sheet
+    flushBatch();
+    const bool built = tileSprites.build(renderer, CELL_SIZE,
+        [this](float x, float y, char letter, int points, TileSpriteState state) {
+            renderTileSprite(x, y, letter, points, state, RenderLayer::TILES);
+            flushBatch();
+        });
+    if (built) ++frameCounters.textureUploads;
+    return built;
+}
+
+void GameRenderer::renderTileSprite(float x, float y, char letter, int points, TileSpriteState state,
+                                    RenderLayer layer) {
+    // Decorations are drawn opaque, as they always appeared with blending off
+    if (state == TileSpriteState::PENDING) {
+        const SDL_FRect highlightRect = {x - 2.0f, y - 2.0f, CELL_SIZE + 2.0f, CELL_SIZE + 2.0f};
+        batch.addRect(layer, highlightRect, {YELLOW_COLOR.r, YELLOW_COLOR.g, YELLOW_COLOR.b, 255});
+    } else if (state == TileSpriteState::SELECTED) {
+        for (int i = 0; i < 3; i++) {
+            const SDL_FRect glowRect = {
+                x - 3.0f - i, y - 3.0f - i,
+                CELL_SIZE + 6.0f + 2*i, CELL_SIZE + 6.0f + 2*i
+            };
+            batch.addRectOutline(layer, glowRect, {255, 215, 0, 255}); // Bright gold
+        }
+
+        for (int i = 0; i < 2; i++) {
+            const SDL_FRect innerBorder = {
+                x - 1.0f - i, y - 1.0f - i,
+                CELL_SIZE + 2.0f + 2*i, CELL_SIZE + 2.0f + 2*i
+            };
+            batch.addRectOutline(layer, innerBorder, {255, 140, 0, 255}); // Dark orange
+        }
+    }
+
     const SDL_FRect tileRect = {x + 2.0f, y + 2.0f, CELL_SIZE - 4.0f, CELL_SIZE - 4.0f};
     
-    SDL_SetRenderDrawColor(renderer, TILE_COLOR.r, TILE_COLOR.g, TILE_COLOR.b, TILE_COLOR.a);
-    SDL_RenderFillRect(renderer, &tileRect);
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-    SDL_RenderRect(renderer, &tileRect);
+    batch.addRect(layer, tileRect, TILE_COLOR);
+    batch.addRectOutline(layer, tileRect, BLACK_COLOR);
     
     const float tileX = tileRect.x;
     const float tileY = tileRect.y;
     const float tileWidth = tileRect.w;
     const float tileHeight = tileRect.h;
 
-    const std::string letter(1, tile->getLetter());
+    const std::string letterText(1, letter);
     
     int textW, textH;
-    if (font && TTF_GetStringSize(font, letter.c_str(), 0, &textW, &textH) == 0) {
+    if (font && TTF_GetStringSize(font, letterText.c_str(), 0, &textW, &textH) == 0) {
         float letterX = tileX + 4.0f;
         float letterY = tileY + 2.0f;
-        renderText(letter, letterX, letterY, BLACK_COLOR, font);
+        queueText(layer, letterText, letterX, letterY, BLACK_COLOR, font);
     } else {
         float letterX = tileX + 4.0f;
         float letterY = tileY + 2.0f;
-        renderText(letter, letterX, letterY, BLACK_COLOR, font);
+        queueText(layer, letterText, letterX, letterY, BLACK_COLOR, font);
     }
 
-    const std::string points = std::to_string(tile->getPoints());
+    const std::string pointsText = std::to_string(points);
     
     int pointsW, pointsH;
-    if (smallFont && TTF_GetStringSize(smallFont, points.c_str(), 0, &pointsW, &pointsH) == 0) {
+    if (smallFont && TTF_GetStringSize(smallFont, pointsText.c_str(), 0, &pointsW, &pointsH) == 0) {
         float pointsX = x + CELL_SIZE - pointsW - 3.0f;
         float pointsY = y + CELL_SIZE - pointsH - 10.0f;
-        renderText(points, pointsX, pointsY, BLACK_COLOR, smallFont);
+        queueText(layer, pointsText, pointsX, pointsY, BLACK_COLOR, smallFont);
     } else {
         float pointsX = x + CELL_SIZE - 12.0f;
         float pointsY = y + CELL_SIZE - 20.0f;
-        renderText(points, pointsX, pointsY, BLACK_COLOR, smallFont);
+        queueText(layer, pointsText, pointsX, pointsY, BLACK_COLOR, smallFont);
     }
 }
 
@@ -859,22 +1043,20 @@ void GameRenderer::renderPlayerRack(const Player& player, float x, float y, bool
     const std::vector<Tile>& rack = player.getRack();
     
     if (isActive) {
-        SDL_SetRenderDrawColor(renderer, 255, 255, 0, 100);
         const SDL_FRect highlightRect = {
             x - 5.0f, y - 5.0f, 
             static_cast<float>(rack.size()) * TILE_SPACING + 10.0f, 
             50.0f
         };
-        SDL_RenderFillRect(renderer, &highlightRect);
+        batch.addRect(RenderLayer::BACKGROUND, highlightRect, {255, 255, 0, 100});
     }
     
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
     const SDL_FRect clearRect = {
         x - 5.0f, y - 5.0f,
         7.0f * TILE_SPACING + 10.0f,
         50.0f
     };
-    SDL_RenderFillRect(renderer, &clearRect);
+    batch.addRect(RenderLayer::BACKGROUND, clearRect, WHITE_COLOR);
     
     const float totalWidth = 7.0f * TILE_SPACING;
     const float actualRackWidth = static_cast<float>(rack.size()) * TILE_SPACING;
@@ -882,7 +1064,7 @@ void GameRenderer::renderPlayerRack(const Player& player, float x, float y, bool
     
     for (size_t i = 0; i < rack.size(); i++) {
         const float tileX = x + centerOffset + static_cast<float>(i) * TILE_SPACING;
-        renderTile(tileX, y, &rack[i]);
+        renderTile(tileX, y, &rack[i], TileSpriteState::PLACED, RenderLayer::TILES);
     }
 }
 
@@ -890,19 +1072,26 @@ void GameRenderer::renderText(const std::string& text, float x, float y, const S
     if (!useFont) useFont = font;
     if (!useFont) return;
 
-    SDL_Surface* textSurface = TTF_RenderText_Solid(useFont, text.c_str(), 0, color);
-    if (!textSurface) return;
-
-    TextureRAII textTexture(SDL_CreateTextureFromSurface(renderer, textSurface));
-    SDL_DestroySurface(textSurface);
+    const TextCache::Entry* entry = textCache.get(renderer, useFont, getGlyphAtlas(useFont), text);
+    if (!entry) return;
 
-    if (!textTexture) return;
+    textVertices.clear();
+    textIndices.clear();
+    TextCache::emit(*entry, x, y, color, textVertices, textIndices);
+    SDL_RenderGeometry(renderer, entry->texture, textVertices.data(), static_cast<int>(textVertices.size()),
+                       textIndices.data(), static_cast<int>(textIndices.size()));
+    ++frameCounters.drawCalls;
+    frameCounters.quads += textIndices.size() / 6;
+}
 
-    float textW, textH;
-    SDL_GetTextureSize(textTexture.get(), &textW, &textH);
+void GameRenderer::queueText(RenderLayer layer, const std::string& text, float x, float y, const SDL_Color& color,
+                             TTF_Font* useFont, TextGroup group) {
+    if (!useFont) useFont = font;
+    if (!useFont) return;
 
-    const SDL_FRect destRect = {x, y, textW, textH};
-    SDL_RenderTexture(renderer, textTexture.get(), nullptr, &destRect);
+    if (const TextCache::Entry* entry = textCache.get(renderer, useFont, getGlyphAtlas(useFont), text, group)) {
+        batch.addText(layer, *entry, x, y, color);
+    }
 }
 
 void GameRenderer::renderSpecialSquareLabel(int row, int col, const std::string& label, const SDL_Color& color) const {
@@ -957,8 +1146,8 @@ void GameRenderer::renderMenuInstructions() const {
 }
 
 bool GameRenderer::initializeTTF() {
-    if (TTF_Init() < 0) {
-        std::cerr << "TTF_Init Error: " << SDL_GetError() << std::endl;
+    if (!TTF_Init()) {
+        LOG_ERROR("TTF_Init Error: " << SDL_GetError());
         return false;
     }
     return true;
@@ -976,22 +1165,43 @@ bool GameRenderer::loadFontsFromPaths() {
     
     for (const auto& path : fontPaths) {
         if (tryLoadFont(path)) {
-            std::cout << "Fonts loaded from: " << path << std::endl;
+            LOG_INFO("Fonts loaded from: " << path);
             return true;
         }
     }
     
-    std::cerr << "Font loading error: " << SDL_GetError() << std::endl;
+    LOG_ERROR("Font loading error: " << SDL_GetError());
     return false;
 }
 
+bool GameRenderer::loadFontFile(const std::string& path) {
+    textCache.clear();
+    fontAtlas.destroy();
+    smallFontAtlas.destroy();
+    titleFontAtlas.destroy();
+    specialFontAtlas.destroy();
+    cleanupFailedFontLoad();
+    invalidateRenderTargets();
+
+    if (!tryLoadFont(path)) {
+        LOG_ERROR("Could not load font: " << path);
+        return false;
+    }
+    return true;
+}
+
 bool GameRenderer::tryLoadFont(const std::string& path) {
+    // A missing file fails the first open; skip the other three sizes
     titleFont = TTF_OpenFont(path.c_str(), TITLE_FONT_SIZE);
+    if (!titleFont) {
+        return false;
+    }
     font = TTF_OpenFont(path.c_str(), NORMAL_FONT_SIZE);
     smallFont = TTF_OpenFont(path.c_str(), SMALL_FONT_SIZE);
     specialFont = TTF_OpenFont(path.c_str(), SPECIAL_FONT_SIZE);
     
     if (titleFont && font && smallFont) {
+        buildGlyphAtlases();
         return true;
     }
     
@@ -1006,6 +1216,26 @@ void GameRenderer::cleanupFailedFontLoad() {
     if (specialFont) { TTF_CloseFont(specialFont); specialFont = nullptr; }
 }
 
+void GameRenderer::buildGlyphAtlases() {
+    // Cached layouts point into the old atlases
+    textCache.clear();
+    frameCounters.textureUploads += fontAtlas.build(renderer, font) ? 1 : 0;
+    frameCounters.textureUploads += smallFontAtlas.build(renderer, smallFont) ? 1 : 0;
+    frameCounters.textureUploads += titleFontAtlas.build(renderer, titleFont) ? 1 : 0;
+    if (specialFont) {
+        frameCounters.textureUploads += specialFontAtlas.build(renderer, specialFont) ? 1 : 0;
+    }
+}
+
+const GlyphAtlas* GameRenderer::getGlyphAtlas(TTF_Font* useFont) const {
+    for (const GlyphAtlas* atlas : {&fontAtlas, &smallFontAtlas, &titleFontAtlas, &specialFontAtlas}) {
+        if (atlas->isReady() && atlas->getFont() == useFont) {
+            return atlas;
+        }
+    }
+    return nullptr;
+}
+
 std::pair<std::string, SDL_Color> GameRenderer::getSpecialSquareTextInfo(SpecialSquare special) const {
     switch (special) {
         case SpecialSquare::DOUBLE_LETTER: return {"2L", BLACK_COLOR};
@@ -1017,44 +1247,41 @@ std::pair<std::string, SDL_Color> GameRenderer::getSpecialSquareTextInfo(Special
     }
 }
 
-void GameRenderer::renderPlayerInfoBox(const Player& player, const SDL_FRect& rect, bool isActive, bool isCurrentTurn) const {
+void GameRenderer::renderPlayerInfoBox(const Player& player, const SDL_FRect& rect, bool isActive, bool isCurrentTurn) {
     if (isCurrentTurn) {
-        SDL_SetRenderDrawColor(renderer, GREEN_COLOR.r, GREEN_COLOR.g, GREEN_COLOR.b, 200);
+        batch.addRect(RenderLayer::BACKGROUND, rect, {GREEN_COLOR.r, GREEN_COLOR.g, GREEN_COLOR.b, 200});
     } else {
-        SDL_SetRenderDrawColor(renderer, 240, 240, 240, 255);
+        batch.addRect(RenderLayer::BACKGROUND, rect, {240, 240, 240, 255});
     }
-    SDL_RenderFillRect(renderer, &rect);
     
     if (isCurrentTurn) {
-        SDL_SetRenderDrawColor(renderer, 0, 150, 0, 255); // Dark green border
         for (int i = 0; i < 3; i++) {
             const SDL_FRect borderRect = {
                 rect.x - i, rect.y - i, 
                 rect.w + 2*i, rect.h + 2*i
             };
-            SDL_RenderRect(renderer, &borderRect);
+            batch.addRectOutline(RenderLayer::UI, borderRect, {0, 150, 0, 255}); // Dark green border
         }
     } else {
-        SDL_SetRenderDrawColor(renderer, 100, 100, 100, 255);
-        SDL_RenderRect(renderer, &rect);
+        batch.addRectOutline(RenderLayer::UI, rect, {100, 100, 100, 255});
     }
     
     const float TEXT_PADDING = 20.0f;
     
-    renderText(player.getName(), rect.x + TEXT_PADDING, rect.y + 15.0f, BLACK_COLOR, font);
+    queueText(RenderLayer::UI, player.getName(), rect.x + TEXT_PADDING, rect.y + 15.0f, BLACK_COLOR, font);
     
     if (isCurrentTurn) {
-        renderText(">>> YOUR TURN", rect.x + TEXT_PADDING, rect.y + 35.0f, RED_COLOR, smallFont);
+        queueText(RenderLayer::UI, ">>> YOUR TURN", rect.x + TEXT_PADDING, rect.y + 35.0f, RED_COLOR, smallFont);
     }
     
     const std::string scoreText = "Score: " + std::to_string(player.getScore());
-    renderText(scoreText, rect.x + TEXT_PADDING, rect.y + 55.0f, BLACK_COLOR, smallFont);
+    queueText(RenderLayer::UI, scoreText, rect.x + TEXT_PADDING, rect.y + 55.0f, BLACK_COLOR, smallFont, TextGroup::SCORES);
     
     const std::string tilesText = "Tiles: " + std::to_string(player.getRack().size());
-    renderText(tilesText, rect.x + TEXT_PADDING, rect.y + 75.0f, BLACK_COLOR, smallFont);
+    queueText(RenderLayer::UI, tilesText, rect.x + TEXT_PADDING, rect.y + 75.0f, BLACK_COLOR, smallFont, TextGroup::SCORES);
     
     if (player.isAI()) {
-        renderText("(AI)", rect.x + TEXT_PADDING, rect.y + 95.0f, BLUE_COLOR, smallFont);
+        queueText(RenderLayer::UI, "(AI)", rect.x + TEXT_PADDING, rect.y + 95.0f, BLUE_COLOR, smallFont);
     }
 }
 
@@ -1184,8 +1411,10 @@ void GameRenderer::renderInformationBoxes(float elapsedTime, float startX, float
     float tutorialAlpha = 0.0f;
     
     if (tutorialAnimating) {
-        Uint64 currentTime = SDL_GetTicks();
-        float animTime = (currentTime - tutorialAnimationStart) / 1000.0f;
+        if (tutorialAnimationStart < 0.0) {
+            tutorialAnimationStart = animationTime;
+        }
+        float animTime = static_cast<float>(animationTime - tutorialAnimationStart);
         float animProgress = std::min(1.0f, animTime / TUTORIAL_ANIMATION_DURATION);
         
         if (tutorialVisible) {
@@ -1938,11 +2167,12 @@ bool GameRenderer::isPointInGameOverExitButton(int x, int y) const {
             y >= buttonY && y <= buttonY + buttonHeight);
 }
 
-void GameRenderer::toggleTutorial() {
+void GameRenderer::setTutorialVisible(bool visible) {
+    if (visible == tutorialVisible) return;
     tutorialAnimating = true;
-    tutorialAnimationStart = SDL_GetTicks();
-    tutorialVisible = !tutorialVisible;
-    std::cout << "Tutorial " << (tutorialVisible ? "opening" : "closing") << " with animation..." << std::endl;
+    tutorialAnimationStart = -1.0;
+    tutorialVisible = visible;
+    LOG_DEBUG("Tutorial " << (tutorialVisible ? "opening" : "closing") << " with animation...");
 }
 
 bool GameRenderer::isTutorialVisible() {
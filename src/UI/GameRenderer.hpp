@@ -8,14 +8,11 @@
 #include "../Core/Board.hpp"
 #include "../Core/Player.hpp"
 #include "../Core/Tile.hpp"
-
-enum class RenderLayer : int {
-    BACKGROUND = 0,
-    BOARD = 1,
-    TILES = 2,
-    UI = 3,
-    OVERLAY = 4
-};
+#include "../Core/PerfCounters.hpp"
+#include "GlyphAtlas.hpp"
+#include "TileSpriteCache.hpp"
+#include "RenderBatch.hpp"
+#include "TextCache.hpp"
 
 enum class TextAlignment {
     LEFT,
@@ -23,6 +20,24 @@ enum class TextAlignment {
     RIGHT
 };
 
+// GPU work of one frame, counted from clear() to present()
+struct RenderCounters {
+    size_t drawCalls;
+    size_t quads;
+    size_t textureUploads;    // textures created or redrawn: atlases, sprites, board layer, text rasters
+};
+
+// Everything the performance HUD shows, gathered by Game on each refresh
+struct PerfHudStats {
+    FrameStats frameTime;
+    FrameStats renderTime;
+    bool vsync;
+    RenderCounters lastFrame;
+    MoveGenerationStats moveGeneration;
+    double lookupsPerSecond;
+    size_t residentBytes;
+};
+
 class GameRenderer {
 private:
     SDL_Renderer* renderer;
@@ -31,6 +46,42 @@ private:
     TTF_Font* smallFont;
     TTF_Font* titleFont;
     TTF_Font* specialFont;
+
+    // One atlas per font, built right after the fonts are opened
+    GlyphAtlas fontAtlas;
+    GlyphAtlas smallFontAtlas;
+    GlyphAtlas titleFontAtlas;
+    GlyphAtlas specialFontAtlas;
+
+    // Grid and premium squares pre-rendered once; only tiles are drawn per frame
+    SDL_Texture* boardLayer;
+    bool boardLayerValid;
+    bool boardLayerFailed;
+
+    TileSpriteCache tileSprites;
+    bool tileSpritesFailed;
+
+    // In-game panels, tiles and text are queued here and drawn per layer at
+    // present(); full-screen overlays flush it first and draw directly
+    RenderBatch batch;
+
+    // Text layouts shared by renderText and queueText
+    mutable TextCache textCache;
+    mutable std::vector<SDL_Vertex> textVertices;
+    mutable std::vector<int> textIndices;
+
+    // Seconds of animation, advanced in fixed ticks by the frame scheduler.
+    // Each animated screen starts its intro the first time it is shown.
+    double animationTime;
+    double menuStartTime;
+    double pauseStartTime;
+    double gameOverStartTime;
+    float getScreenElapsedTime(double& startTime);
+
+    // Reset by clear(), copied to lastFrameCounters by present()
+    mutable RenderCounters frameCounters;
+    RenderCounters lastFrameCounters;
+    size_t textUploadsSeen;
     
     static const SDL_Color BOARD_COLOR;
     static const SDL_Color TILE_COLOR;
@@ -96,15 +147,16 @@ public:
     ~GameRenderer();
     bool initializeFonts();
     void cleanupFonts();
-    void renderGameState(const Game& game);
+    bool loadFontFile(const std::string& path);
+    void renderGameState(const GameSnapshot& snapshot);
     void renderBoard(const Board& board);
-    void renderPickedTiles(const Game& game); 
-    void renderSelectedTileIndicator(const Game& game);
-    void renderTilePreview(const Game& game, int mouseX, int mouseY);
+    void renderPickedTiles(const GameSnapshot& snapshot); 
+    void renderSelectedTileIndicator(const GameSnapshot& snapshot);
+    void renderTilePreview(const GameSnapshot& snapshot, int mouseX, int mouseY);
     void renderPlayerRacks(const Player& player1, const Player& player2, int currentPlayer);
     void renderPlayerInfo(const Player& player1, const Player& player2, int currentPlayer);
     void renderScores(const Player& player1, const Player& player2);
-    void renderCurrentWordScore(const Game& game);
+    void renderCurrentWordScore(const GameSnapshot& snapshot);
     void renderGameStart();
     void renderMenu();
     void renderGameOver(const Player& player1, const Player& player2);
@@ -113,7 +165,14 @@ public:
     void renderPauseMenu();
     void clear();
     void present();
+    void advanceAnimation(double seconds);
+    void invalidateRenderTargets();
+    void recreateDeviceTextures();
+    void invalidateScoreText();
+    RenderCounters getLastFrameCounters() const;
+    void renderPerfHud(const PerfHudStats& stats);
     SDL_FRect getBoardCellRect(int row, int col) const;
+    static SDL_Rect getBoardBounds();
     bool isPointInBoard(int x, int y, int& row, int& col) const;
     bool isPointInPauseButton(int x, int y) const;
     PauseMenuOption getPauseMenuOption(int x, int y) const;
@@ -126,18 +185,26 @@ public:
     bool isPointInSwitchTurnButton(int x, int y) const;
     bool isPointInSubmitButton(int x, int y) const;
     bool isPointInCancelButton(int x, int y) const;
-    static void toggleTutorial();
+    static void setTutorialVisible(bool visible);
     static bool isTutorialVisible();
 
 private:
-    void renderGrid();
-    void renderSpecialSquares(const Board& board);
-    void renderSingleSpecialSquare(int row, int col, SpecialSquare special);
+    void renderGrid(float originX, float originY);
+    void renderSpecialSquares(const Board& board, float originX, float originY);
+    void renderSingleSpecialSquare(int row, int col, SpecialSquare special, float originX, float originY);
+    bool buildBoardLayer(const Board& board);
+    void destroyBoardLayer();
+    void invalidateBoardLayer();
     void renderSpecialSquareText(float x, float y, SpecialSquare special);
     void renderTiles(const Board& board);
-    void renderTile(float x, float y, const Tile* tile);
+    void renderTile(float x, float y, const Tile* tile, TileSpriteState state, RenderLayer layer);
+    void renderTileSprite(float x, float y, char letter, int points, TileSpriteState state, RenderLayer layer);
+    bool buildTileSprites();
     void renderPlayerRack(const Player& player, float x, float y, bool isActive);
     void renderText(const std::string& text, float x, float y, const SDL_Color& color, TTF_Font* useFont = nullptr) const;
+    void queueText(RenderLayer layer, const std::string& text, float x, float y, const SDL_Color& color,
+                   TTF_Font* useFont = nullptr, TextGroup group = TextGroup::STATIC);
+    void flushBatch();
     void renderSpecialSquareLabel(int row, int col, const std::string& label, const SDL_Color& color) const;
     void renderMenuBackground() const;
     void renderMenuContent() const;
@@ -146,7 +213,9 @@ private:
     bool loadFontsFromPaths();
     bool tryLoadFont(const std::string& path);
     void cleanupFailedFontLoad();
-    void renderPlayerInfoBox(const Player& player, const SDL_FRect& rect, bool isActive, bool isCurrentTurn) const;
+    void buildGlyphAtlases();
+    const GlyphAtlas* getGlyphAtlas(TTF_Font* useFont) const;
+    void renderPlayerInfoBox(const Player& player, const SDL_FRect& rect, bool isActive, bool isCurrentTurn);
     void renderFullWidthTitle(float elapsedTime, float startY, float titleHeight);
     void renderInformationBoxes(float elapsedTime, float startX, float startY, float boxWidth);
     void renderSideButtons(float elapsedTime, float startX, float startY, float buttonWidth);
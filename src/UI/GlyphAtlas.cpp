@@ -0,0 +1,234 @@
+#include "GlyphAtlas.hpp"
+#include "../Core/Logger.hpp"
+#include <algorithm>
+#include <cmath>
+
+static const int ASCII_GLYPHS = 126 - 32 + 1;
+
+GlyphAtlas::GlyphAtlas()
+    : texture(nullptr), font(nullptr), textureWidth(0.0f), textureHeight(0.0f), lineHeight(0.0f) {
+    for (auto& glyph : glyphs) {
+        glyph = Glyph{{0.0f, 0.0f, 0.0f, 0.0f}, 0.0f, 0.0f, false};
+    }
+}
+
+GlyphAtlas::~GlyphAtlas() {
+    destroy();
+}
+
+int GlyphAtlas::glyphIndex(uint32_t codepoint) {
+    if (codepoint >= FIRST_CHAR && codepoint <= LAST_CHAR) {
+        return static_cast<int>(codepoint - FIRST_CHAR);
+    }
+    if (codepoint == BULLET_CHAR) {
+        return ASCII_GLYPHS;
+    }
+    return -1;
+}
+
+uint32_t GlyphAtlas::decodeUtf8(const std::string& text, size_t& pos) {
+    const unsigned char lead = static_cast<unsigned char>(text[pos++]);
+    if (lead < 0x80) return lead;
+
+    int extra = (lead >= 0xF0) ? 3 : (lead >= 0xE0) ? 2 : (lead >= 0xC0) ? 1 : -1;
+    if (extra < 0) return 0xFFFD;
+
+    uint32_t codepoint = lead & (0x3F >> extra);
+    for (int i = 0; i < extra; ++i) {
+        if (pos >= text.size() || (static_cast<unsigned char>(text[pos]) & 0xC0) != 0x80) {
+            return 0xFFFD;
+        }
+        codepoint = (codepoint << 6) | (static_cast<unsigned char>(text[pos++]) & 0x3F);
+    }
+    return codepoint;
+}
+
+bool GlyphAtlas::build(SDL_Renderer* renderer, TTF_Font* sourceFont) {
+    destroy();
+    if (!renderer || !sourceFont) return false;
+
+    font = sourceFont;
+    lineHeight = static_cast<float>(TTF_GetFontHeight(font));
+
+    const SDL_Color white = {255, 255, 255, 255};
+    SDL_Surface* bitmaps[GLYPH_COUNT] = {nullptr};
+
+    for (int i = 0; i < GLYPH_COUNT; ++i) {
+        const uint32_t codepoint = (i < ASCII_GLYPHS) ? FIRST_CHAR + i : BULLET_CHAR;
+        int minX = 0, maxX = 0, minY = 0, maxY = 0, advance = 0;
+        if (!TTF_FontHasGlyph(font, codepoint) ||
+            !TTF_GetGlyphMetrics(font, codepoint, &minX, &maxX, &minY, &maxY, &advance)) {
+            continue;
+        }
+
+        glyphs[i].present = true;
+        glyphs[i].offsetX = static_cast<float>(minX);
+        glyphs[i].advance = static_cast<float>(advance);
+
+        // Whitespace has metrics but no bitmap
+        if (maxX > minX) {
+            bitmaps[i] = TTF_RenderGlyph_Blended(font, codepoint, white);
+        }
+    }
+
+    // Shelf-pack the bitmaps; every glyph is one line tall so rows stay tight
+    const int atlasWidth = (lineHeight > 40.0f) ? 1024 : 512;
+    int penX = GLYPH_PADDING;
+    int penY = GLYPH_PADDING;
+    int rowHeight = 0;
+    for (int i = 0; i < GLYPH_COUNT; ++i) {
+        if (!bitmaps[i]) continue;
+
+        const int w = bitmaps[i]->w;
+        const int h = bitmaps[i]->h;
+        if (penX + w + GLYPH_PADDING > atlasWidth) {
+            penX = GLYPH_PADDING;
+            penY += rowHeight + GLYPH_PADDING;
+            rowHeight = 0;
+        }
+        glyphs[i].source = {static_cast<float>(penX), static_cast<float>(penY),
+                            static_cast<float>(w), static_cast<float>(h)};
+        penX += w + GLYPH_PADDING;
+        rowHeight = std::max(rowHeight, h);
+    }
+    const int atlasHeight = penY + rowHeight + GLYPH_PADDING;
+
+    SDL_Surface* atlas = SDL_CreateSurface(atlasWidth, atlasHeight, SDL_PIXELFORMAT_ARGB8888);
+    if (atlas) {
+        SDL_FillSurfaceRect(atlas, nullptr, 0);
+        for (int i = 0; i < GLYPH_COUNT; ++i) {
+            if (!bitmaps[i]) continue;
+
+            // Copy the coverage as-is instead of blending it onto the empty atlas
+            SDL_SetSurfaceBlendMode(bitmaps[i], SDL_BLENDMODE_NONE);
+            SDL_Rect dest = {static_cast<int>(glyphs[i].source.x), static_cast<int>(glyphs[i].source.y),
+                             bitmaps[i]->w, bitmaps[i]->h};
+            SDL_BlitSurface(bitmaps[i], nullptr, atlas, &dest);
+        }
+        texture = SDL_CreateTextureFromSurface(renderer, atlas);
+        SDL_DestroySurface(atlas);
+    }
+    for (auto* bitmap : bitmaps) {
+        if (bitmap) SDL_DestroySurface(bitmap);
+    }
+
+    if (!texture) {
+        LOG_WARN("Glyph atlas creation failed: " << SDL_GetError());
+        destroy();
+        return false;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+    textureWidth = static_cast<float>(atlasWidth);
+    textureHeight = static_cast<float>(atlasHeight);
+
+    kerning.assign(ASCII_GLYPHS * ASCII_GLYPHS, 0);
+    for (int previous = 0; previous < ASCII_GLYPHS; ++previous) {
+        for (int current = 0; current < ASCII_GLYPHS; ++current) {
+            int amount = 0;
+            if (TTF_GetGlyphKerning(font, FIRST_CHAR + previous, FIRST_CHAR + current, &amount)) {
+                kerning[previous * ASCII_GLYPHS + current] = static_cast<int8_t>(std::clamp(amount, -128, 127));
+            }
+        }
+    }
+    return true;
+}
+
+void GlyphAtlas::destroy() {
+    if (texture) {
+        SDL_DestroyTexture(texture);
+        texture = nullptr;
+    }
+    font = nullptr;
+    kerning.clear();
+    for (auto& glyph : glyphs) {
+        glyph = Glyph{{0.0f, 0.0f, 0.0f, 0.0f}, 0.0f, 0.0f, false};
+    }
+}
+
+bool GlyphAtlas::isReady() const {
+    return texture != nullptr;
+}
+
+TTF_Font* GlyphAtlas::getFont() const {
+    return font;
+}
+
+SDL_Texture* GlyphAtlas::getTexture() const {
+    return texture;
+}
+
+float GlyphAtlas::getLineHeight() const {
+    return lineHeight;
+}
+
+float GlyphAtlas::appendText(const std::string& text, float x, float y, const SDL_Color& color,
+                             std::vector<SDL_Vertex>& outVertices, std::vector<int>& outIndices) const {
+    if (!texture) return 0.0f;
+
+    const SDL_FColor tint = {color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+    const float baseY = std::floor(y + 0.5f);
+    const int fallback = glyphIndex('?');
+    float pen = x;
+    int previous = -1;
+
+    for (size_t pos = 0; pos < text.size();) {
+        int index = glyphIndex(decodeUtf8(text, pos));
+        if (index < 0 || !glyphs[index].present) index = fallback;
+        const Glyph& glyph = glyphs[index];
+
+        if (previous >= 0 && previous < ASCII_GLYPHS && index < ASCII_GLYPHS && !kerning.empty()) {
+            pen += kerning[previous * ASCII_GLYPHS + index];
+        }
+        previous = index;
+
+        if (glyph.source.w > 0.0f) {
+            // Snap to whole pixels so the nearest-sampled glyphs stay crisp
+            const float left = std::floor(pen + glyph.offsetX + 0.5f);
+            const float right = left + glyph.source.w;
+            const float bottom = baseY + glyph.source.h;
+            const float u0 = glyph.source.x / textureWidth;
+            const float v0 = glyph.source.y / textureHeight;
+            const float u1 = (glyph.source.x + glyph.source.w) / textureWidth;
+            const float v1 = (glyph.source.y + glyph.source.h) / textureHeight;
+
+            const int base = static_cast<int>(outVertices.size());
+            outVertices.push_back({{left, baseY}, tint, {u0, v0}});
+            outVertices.push_back({{right, baseY}, tint, {u1, v0}});
+            outVertices.push_back({{right, bottom}, tint, {u1, v1}});
+            outVertices.push_back({{left, bottom}, tint, {u0, v1}});
+            outIndices.insert(outIndices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+        }
+        pen += glyph.advance;
+    }
+    return pen - x;
+}
+
+void GlyphAtlas::drawText(SDL_Renderer* renderer, const std::string& text, float x, float y,
+                          const SDL_Color& color) const {
+    vertices.clear();
+    indices.clear();
+    appendText(text, x, y, color, vertices, indices);
+    if (indices.empty()) return;
+
+    SDL_RenderGeometry(renderer, texture, vertices.data(), static_cast<int>(vertices.size()),
+                       indices.data(), static_cast<int>(indices.size()));
+}
+
+float GlyphAtlas::measureText(const std::string& text) const {
+    const int fallback = glyphIndex('?');
+    float width = 0.0f;
+    int previous = -1;
+
+    for (size_t pos = 0; pos < text.size();) {
+        int index = glyphIndex(decodeUtf8(text, pos));
+        if (index < 0 || !glyphs[index].present) index = fallback;
+
+        if (previous >= 0 && previous < ASCII_GLYPHS && index < ASCII_GLYPHS && !kerning.empty()) {
+            width += kerning[previous * ASCII_GLYPHS + index];
+        }
+        previous = index;
+        width += glyphs[index].advance;
+    }
+    return width;
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Every printable ASCII glyph of one font (plus the bullet used in the menus)
+// rendered once in white into a single texture. Text is then drawn as one
+// batch of textured quads tinted with the requested colour, so drawing a
+// string never creates a surface or a texture.
+class GlyphAtlas {
+private:
+    static const uint32_t FIRST_CHAR = 32;
+    static const uint32_t LAST_CHAR = 126;
+    static const uint32_t BULLET_CHAR = 0x2022;
+    static const int GLYPH_COUNT = LAST_CHAR - FIRST_CHAR + 2;   // ASCII + bullet
+    static const int GLYPH_PADDING = 1;
+
+    struct Glyph {
+        SDL_FRect source;     // pixels inside the atlas texture
+        float offsetX;        // where the bitmap starts relative to the pen
+        float advance;
+        bool present;
+    };
+
+    SDL_Texture* texture;
+    TTF_Font* font;
+    float textureWidth;
+    float textureHeight;
+    float lineHeight;
+    Glyph glyphs[GLYPH_COUNT];
+    std::vector<int8_t> kerning;      // ASCII pairs, [previous * ascii + current]
+
+    mutable std::vector<SDL_Vertex> vertices;
+    mutable std::vector<int> indices;
+
+    static int glyphIndex(uint32_t codepoint);
+    static uint32_t decodeUtf8(const std::string& text, size_t& pos);
+
+public:
+    GlyphAtlas();
+    ~GlyphAtlas();
+
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+    bool build(SDL_Renderer* renderer, TTF_Font* sourceFont);
+    void destroy();
+
+    bool isReady() const;
+    TTF_Font* getFont() const;
+    SDL_Texture* getTexture() const;
+    float getLineHeight() const;
+
+    // Appends two triangles per visible glyph; returns the pen advance.
+    float appendText(const std::string& text, float x, float y, const SDL_Color& color,
+                     std::vector<SDL_Vertex>& outVertices, std::vector<int>& outIndices) const;
+    void drawText(SDL_Renderer* renderer, const std::string& text, float x, float y,
+                  const SDL_Color& color) const;
+    float measureText(const std::string& text) const;
+};
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include "OffscreenRenderer.hpp"
+#include "../Core/Logger.hpp"
+#include <SDL3_image/SDL_image.h>
+
+OffscreenRenderer::OffscreenRenderer() : surface(nullptr), renderer(nullptr), boardBounds{0, 0, 0, 0} {}
+
+OffscreenRenderer::~OffscreenRenderer() {
+    cleanup();
+}
+
+bool OffscreenRenderer::initializeHeadless() {
+    SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+    if (!SDL_Init(SDL_INIT_VIDEO)) {
+        LOG_ERROR("SDL initialization failed: " << SDL_GetError());
+        return false;
+    }
+    if (!TTF_Init()) {
+        LOG_ERROR("SDL_ttf initialization failed: " << SDL_GetError());
+        SDL_Quit();
+        return false;
+    }
+    return true;
+}
+
+void OffscreenRenderer::shutdownHeadless() {
+    TTF_Quit();
+    SDL_Quit();
+}
+
+bool OffscreenRenderer::initialize(const std::string& fontPath) {
+    cleanup();
+
+    // Only the area up to the board's far corner is ever drawn
+    boardBounds = GameRenderer::getBoardBounds();
+
+    surface = SDL_CreateSurface(boardBounds.x + boardBounds.w, boardBounds.y + boardBounds.h,
+                                SDL_PIXELFORMAT_ARGB8888);
+    if (!surface) {
+        LOG_ERROR("Offscreen surface creation failed: " << SDL_GetError());
+        return false;
+    }
+    SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+
+    renderer = SDL_CreateSoftwareRenderer(surface);
+    if (!renderer) {
+        LOG_ERROR("Software renderer creation failed: " << SDL_GetError());
+        cleanup();
+        return false;
+    }
+
+    gameRenderer = std::make_unique<GameRenderer>(renderer, nullptr);
+    if (!fontPath.empty() && !gameRenderer->loadFontFile(fontPath)) {
+        cleanup();
+        return false;
+    }
+    return true;
+}
+
+void OffscreenRenderer::cleanup() {
+    gameRenderer.reset();
+    if (renderer) {
+        SDL_DestroyRenderer(renderer);
+        renderer = nullptr;
+    }
+    if (surface) {
+        SDL_DestroySurface(surface);
+        surface = nullptr;
+    }
+}
+
+SDL_Surface* OffscreenRenderer::renderBoard(const Board& board) {
+    if (!gameRenderer) return nullptr;
+
+    gameRenderer->clear();
+    gameRenderer->renderBoard(board);
+    gameRenderer->present();
+
+    SDL_Surface* snapshot = SDL_CreateSurface(boardBounds.w, boardBounds.h, surface->format);
+    if (!snapshot) return nullptr;
+    if (!SDL_BlitSurface(surface, &boardBounds, snapshot, nullptr)) {
+        SDL_DestroySurface(snapshot);
+        return nullptr;
+    }
+    return snapshot;
+}
+
+bool OffscreenRenderer::saveBoardPng(const Board& board, const std::string& filename) {
+    SDL_Surface* snapshot = renderBoard(board);
+    if (!snapshot) {
+        LOG_ERROR("Board snapshot failed: " << SDL_GetError());
+        return false;
+    }
+
+    const bool saved = IMG_SavePNG(snapshot, filename.c_str());
+    if (!saved) {
+        LOG_ERROR("Could not write " << filename << ": " << SDL_GetError());
+    }
+    SDL_DestroySurface(snapshot);
+    return saved;
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <memory>
+#include <string>
+#include "GameRenderer.hpp"
+
+// Draws boards with the game's own GameRenderer into a software renderer
+// backed by a plain surface, so snapshots need no window or GPU.
+class OffscreenRenderer {
+private:
+    SDL_Surface* surface;
+    SDL_Renderer* renderer;
+    std::unique_ptr<GameRenderer> gameRenderer;
+    SDL_Rect boardBounds;
+
+public:
+    OffscreenRenderer();
+    ~OffscreenRenderer();
+
+    OffscreenRenderer(const OffscreenRenderer&) = delete;
+    OffscreenRenderer& operator=(const OffscreenRenderer&) = delete;
+
+    // Selects SDL's dummy video driver and starts SDL and SDL_ttf.
+    static bool initializeHeadless();
+    static void shutdownHeadless();
+
+    // An empty fontPath keeps the renderer's default font search.
+    bool initialize(const std::string& fontPath = "");
+    void cleanup();
+
+    // Returns a new surface holding only the board; the caller destroys it.
+    SDL_Surface* renderBoard(const Board& board);
+    bool saveBoardPng(const Board& board, const std::string& filename);
+};
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include "RenderBatch.hpp"
+
+static SDL_FColor toFColor(const SDL_Color& color) {
+    return {color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+}
+
+RenderBatch::RenderBatch() : lastDrawCalls(0), lastQuadCount(0) {
+    for (auto& layer : layers) {
+        layer.used = 0;
+    }
+}
+
+RenderBatch::~RenderBatch() {
+    discard();
+}
+
+RenderBatch::Batch& RenderBatch::batchFor(RenderLayer layer, SDL_Texture* texture) {
+    Layer& target = layers[static_cast<int>(layer)];
+    if (target.used > 0 && target.batches[target.used - 1].texture == texture) {
+        return target.batches[target.used - 1];
+    }
+
+    if (target.used == target.batches.size()) {
+        target.batches.emplace_back();
+    }
+    Batch& batch = target.batches[target.used++];
+    batch.texture = texture;
+    batch.textureWidth = 1.0f;
+    batch.textureHeight = 1.0f;
+    batch.vertices.clear();
+    batch.indices.clear();
+    if (texture) {
+        SDL_GetTextureSize(texture, &batch.textureWidth, &batch.textureHeight);
+    }
+    return batch;
+}
+
+void RenderBatch::appendQuad(Batch& batch, const SDL_FRect& dest, float u0, float v0, float u1, float v1,
+                             const SDL_FColor& color) {
+    const int base = static_cast<int>(batch.vertices.size());
+    const float right = dest.x + dest.w;
+    const float bottom = dest.y + dest.h;
+    batch.vertices.push_back({{dest.x, dest.y}, color, {u0, v0}});
+    batch.vertices.push_back({{right, dest.y}, color, {u1, v0}});
+    batch.vertices.push_back({{right, bottom}, color, {u1, v1}});
+    batch.vertices.push_back({{dest.x, bottom}, color, {u0, v1}});
+    batch.indices.insert(batch.indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+}
+
+void RenderBatch::addRect(RenderLayer layer, const SDL_FRect& rect, const SDL_Color& color) {
+    if (rect.w <= 0.0f || rect.h <= 0.0f) return;
+    appendQuad(batchFor(layer, nullptr), rect, 0.0f, 0.0f, 0.0f, 0.0f, toFColor(color));
+}
+
+void RenderBatch::addRectOutline(RenderLayer layer, const SDL_FRect& rect, const SDL_Color& color) {
+    if (rect.w <= 0.0f || rect.h <= 0.0f) return;
+
+    const SDL_FRect top = {rect.x, rect.y, rect.w, 1.0f};
+    const SDL_FRect bottom = {rect.x, rect.y + rect.h - 1.0f, rect.w, 1.0f};
+    const SDL_FRect left = {rect.x, rect.y + 1.0f, 1.0f, rect.h - 2.0f};
+    const SDL_FRect right = {rect.x + rect.w - 1.0f, rect.y + 1.0f, 1.0f, rect.h - 2.0f};
+    addRect(layer, top, color);
+    addRect(layer, bottom, color);
+    addRect(layer, left, color);
+    addRect(layer, right, color);
+}
+
+void RenderBatch::addTexture(RenderLayer layer, SDL_Texture* texture, const SDL_FRect* source,
+                             const SDL_FRect& dest) {
+    if (!texture) return;
+
+    Batch& batch = batchFor(layer, texture);
+    float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;
+    if (source) {
+        u0 = source->x / batch.textureWidth;
+        v0 = source->y / batch.textureHeight;
+        u1 = (source->x + source->w) / batch.textureWidth;
+        v1 = (source->y + source->h) / batch.textureHeight;
+    }
+    appendQuad(batch, dest, u0, v0, u1, v1, {1.0f, 1.0f, 1.0f, 1.0f});
+}
+
+void RenderBatch::addText(RenderLayer layer, const TextCache::Entry& text, float x, float y, const SDL_Color& color) {
+    if (text.indices.empty()) return;
+
+    Batch& batch = batchFor(layer, text.texture);
+    TextCache::emit(text, x, y, color, batch.vertices, batch.indices);
+}
+
+bool RenderBatch::isEmpty() const {
+    for (const auto& layer : layers) {
+        if (layer.used > 0) return false;
+    }
+    return true;
+}
+
+void RenderBatch::flush(SDL_Renderer* renderer) {
+    lastDrawCalls = 0;
+    lastQuadCount = 0;
+    for (auto& layer : layers) {
+        for (size_t i = 0; i < layer.used; ++i) {
+            const Batch& batch = layer.batches[i];
+            if (batch.indices.empty()) continue;
+
+            SDL_RenderGeometry(renderer, batch.texture, batch.vertices.data(), static_cast<int>(batch.vertices.size()),
+                               batch.indices.data(), static_cast<int>(batch.indices.size()));
+            ++lastDrawCalls;
+            lastQuadCount += batch.indices.size() / 6;
+        }
+    }
+    discard();
+}
+
+void RenderBatch::discard() {
+    for (auto& layer : layers) {
+        layer.used = 0;
+    }
+}
+
+size_t RenderBatch::getLastDrawCalls() const {
+    return lastDrawCalls;
+}
+
+size_t RenderBatch::getLastQuadCount() const {
+    return lastQuadCount;
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <string>
+#include <vector>
+#include "TextCache.hpp"
+
+enum class RenderLayer : int {
+    BACKGROUND = 0,
+    BOARD = 1,
+    TILES = 2,
+    UI = 3,
+    OVERLAY = 4
+};
+
+// Collects a frame's coloured and textured quads per layer and submits them
+// with one SDL_RenderGeometry call per run of quads sharing a texture.
+// Layers are drawn back to front; inside a layer, submission order is kept.
+class RenderBatch {
+public:
+    static const int LAYER_COUNT = static_cast<int>(RenderLayer::OVERLAY) + 1;
+
+    RenderBatch();
+    ~RenderBatch();
+
+    RenderBatch(const RenderBatch&) = delete;
+    RenderBatch& operator=(const RenderBatch&) = delete;
+
+    void addRect(RenderLayer layer, const SDL_FRect& rect, const SDL_Color& color);
+    // Same pixels as SDL_RenderRect: a one pixel frame inside the rectangle.
+    void addRectOutline(RenderLayer layer, const SDL_FRect& rect, const SDL_Color& color);
+    void addTexture(RenderLayer layer, SDL_Texture* texture, const SDL_FRect* source, const SDL_FRect& dest);
+    void addText(RenderLayer layer, const TextCache::Entry& text, float x, float y, const SDL_Color& color);
+
+    bool isEmpty() const;
+    void flush(SDL_Renderer* renderer);
+    void discard();
+
+    size_t getLastDrawCalls() const;
+    size_t getLastQuadCount() const;
+
+private:
+    struct Batch {
+        SDL_Texture* texture;
+        float textureWidth;
+        float textureHeight;
+        std::vector<SDL_Vertex> vertices;
+        std::vector<int> indices;
+    };
+
+    struct Layer {
+        std::vector<Batch> batches;   // kept between frames so the buffers stay allocated
+        size_t used;
+    };
+
+    Layer layers[LAYER_COUNT];
+    size_t lastDrawCalls;
+    size_t lastQuadCount;
+
+    Batch& batchFor(RenderLayer layer, SDL_Texture* texture);
+    static void appendQuad(Batch& batch, const SDL_FRect& dest, float u0, float v0, float u1, float v1,
+                           const SDL_FColor& color);
+};
\ No newline at end of file
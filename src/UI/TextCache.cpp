@@ -0,0 +1,149 @@
+#include "TextCache.hpp"
+#include <cmath>
+#include <functional>
+
+size_t TextCache::KeyHash::operator()(const Key& key) const {
+    const size_t textHash = std::hash<std::string>()(key.text);
+    const size_t fontHash = std::hash<const void*>()(key.font);
+    return textHash ^ (fontHash + 0x9E3779B97F4A7C15ULL + (textHash << 6) + (textHash >> 2));
+}
+
+TextCache::TextCache(size_t capacity) : capacity(capacity), hits(0), misses(0), textureUploads(0) {}
+
+TextCache::~TextCache() {
+    clear();
+}
+
+bool TextCache::buildEntry(SDL_Renderer* renderer, TTF_Font* font, const GlyphAtlas* atlas,
+                           const std::string& text, Entry& entry) {
+    const SDL_Color white = {255, 255, 255, 255};
+    entry.texture = nullptr;
+    entry.ownsTexture = false;
+    entry.width = 0.0f;
+
+    if (atlas && atlas->isReady()) {
+        entry.texture = atlas->getTexture();
+        entry.width = atlas->appendText(text, 0.0f, 0.0f, white, entry.vertices, entry.indices);
+        return true;
+    }
+
+    SDL_Surface* surface = TTF_RenderText_Solid(font, text.c_str(), 0, white);
+    if (!surface) return false;
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_DestroySurface(surface);
+    if (!texture) return false;
+    ++textureUploads;
+
+    float w = 0.0f, h = 0.0f;
+    SDL_GetTextureSize(texture, &w, &h);
+    const SDL_FColor tint = {1.0f, 1.0f, 1.0f, 1.0f};
+    entry.vertices = {
+        {{0.0f, 0.0f}, tint, {0.0f, 0.0f}},
+        {{w, 0.0f}, tint, {1.0f, 0.0f}},
+        {{w, h}, tint, {1.0f, 1.0f}},
+        {{0.0f, h}, tint, {0.0f, 1.0f}}
+    };
+    entry.indices = {0, 1, 2, 0, 2, 3};
+    entry.texture = texture;
+    entry.ownsTexture = true;
+    entry.width = w;
+    return true;
+}
+
+void TextCache::releaseEntry(Entry& entry) {
+    if (entry.ownsTexture && entry.texture) {
+        pendingRelease.push_back(entry.texture);
+    }
+    entry.texture = nullptr;
+    entry.ownsTexture = false;
+}
+
+const TextCache::Entry* TextCache::get(SDL_Renderer* renderer, TTF_Font* font, const GlyphAtlas* atlas,
+                                       const std::string& text, TextGroup group) {
+    if (!font || text.empty()) return nullptr;
+
+    Key key{font, text};
+    auto found = index.find(key);
+    if (found != index.end()) {
+        ++hits;
+        entries.splice(entries.begin(), entries, found->second);
+        return &found->second->second;
+    }
+
+    ++misses;
+    Entry entry;
+    entry.group = group;
+    if (!buildEntry(renderer, font, atlas, text, entry)) return nullptr;
+
+    entries.emplace_front(key, std::move(entry));
+    index.emplace(std::move(key), entries.begin());
+
+    while (entries.size() > capacity) {
+        releaseEntry(entries.back().second);
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+    return &entries.front().second;
+}
+
+void TextCache::emit(const Entry& entry, float x, float y, const SDL_Color& color,
+                     std::vector<SDL_Vertex>& outVertices, std::vector<int>& outIndices) {
+    // Whole-pixel offsets keep nearest-sampled glyphs crisp
+    const float offsetX = std::floor(x + 0.5f);
+    const float offsetY = std::floor(y + 0.5f);
+    const SDL_FColor tint = {color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+    const int base = static_cast<int>(outVertices.size());
+
+    for (const SDL_Vertex& vertex : entry.vertices) {
+        outVertices.push_back({{vertex.position.x + offsetX, vertex.position.y + offsetY}, tint, vertex.tex_coord});
+    }
+    for (int i : entry.indices) {
+        outIndices.push_back(base + i);
+    }
+}
+
+void TextCache::invalidateGroup(TextGroup group) {
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (it->second.group == group) {
+            releaseEntry(it->second);
+            index.erase(it->first);
+            it = entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void TextCache::clear() {
+    // Only called between frames (font or device changes, shutdown), so
+    // nothing queued can still refer to these textures
+    for (auto& item : entries) {
+        releaseEntry(item.second);
+    }
+    entries.clear();
+    index.clear();
+    releasePending();
+}
+
+void TextCache::releasePending() {
+    for (SDL_Texture* texture : pendingRelease) {
+        SDL_DestroyTexture(texture);
+    }
+    pendingRelease.clear();
+}
+
+size_t TextCache::getSize() const {
+    return entries.size();
+}
+
+size_t TextCache::getHits() const {
+    return hits;
+}
+
+size_t TextCache::getMisses() const {
+    return misses;
+}
+
+size_t TextCache::getTextureUploads() const {
+    return textureUploads;
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "GlyphAtlas.hpp"
+
+enum class TextGroup : int {
+    STATIC = 0,     // labels that never change
+    SCORES = 1,     // score and word preview text, dropped whenever a score changes
+    HUD = 2         // performance readouts, replaced on every refresh
+};
+
+// Laid-out strings keyed by (font, text). An entry is the string's quads in
+// white relative to its origin, so drawing it again in any colour or place
+// is a copy and a tint: no UTF-8 decoding, kerning or rasterising. Fonts
+// without a glyph atlas are rasterised once into a texture of their own.
+// The least recently used entries are evicted past the capacity.
+class TextCache {
+public:
+    struct Entry {
+        SDL_Texture* texture;           // the font's atlas, or an owned raster
+        bool ownsTexture;
+        std::vector<SDL_Vertex> vertices;
+        std::vector<int> indices;
+        float width;
+        TextGroup group;
+    };
+
+    explicit TextCache(size_t capacity = 512);
+    ~TextCache();
+
+    TextCache(const TextCache&) = delete;
+    TextCache& operator=(const TextCache&) = delete;
+
+    // Returns nullptr when the text cannot be drawn with this font.
+    const Entry* get(SDL_Renderer* renderer, TTF_Font* font, const GlyphAtlas* atlas, const std::string& text,
+                     TextGroup group = TextGroup::STATIC);
+
+    // Appends the entry at (x, y) tinted with `color`.
+    static void emit(const Entry& entry, float x, float y, const SDL_Color& color,
+                     std::vector<SDL_Vertex>& outVertices, std::vector<int>& outIndices);
+
+    void invalidateGroup(TextGroup group);
+    void clear();
+
+    // Owned rasters dropped by eviction or invalidation may still have quads
+    // queued in the render batch; they are destroyed here, after the flush.
+    void releasePending();
+
+    size_t getSize() const;
+    size_t getHits() const;
+    size_t getMisses() const;
+    size_t getTextureUploads() const;    // rasters created for fonts without an atlas
+
+private:
+    struct Key {
+        const TTF_Font* font;
+        std::string text;
+
+        bool operator==(const Key& other) const {
+            return font == other.font && text == other.text;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    using LruList = std::list<std::pair<Key, Entry>>;
+
+    size_t capacity;
+    LruList entries;                 // most recently used first
+    std::unordered_map<Key, LruList::iterator, KeyHash> index;
+    size_t hits;
+    size_t misses;
+    size_t textureUploads;
+    std::vector<SDL_Texture*> pendingRelease;
+
+    bool buildEntry(SDL_Renderer* renderer, TTF_Font* font, const GlyphAtlas* atlas, const std::string& text,
+                    Entry& entry);
+    void releaseEntry(Entry& entry);
+};
\ No newline at end of file
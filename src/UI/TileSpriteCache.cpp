@@ -0,0 +1,100 @@
+#include "TileSpriteCache.hpp"
+#include "../Core/Tile.hpp"
+#include "../Core/Logger.hpp"
+
+TileSpriteCache::TileSpriteCache() : sheet(nullptr), spriteSize(0) {}
+
+TileSpriteCache::~TileSpriteCache() {
+    invalidate();
+}
+
+int TileSpriteCache::letterSlot(char letter) {
+    if (letter == ' ') return 0;
+    if (letter >= 'A' && letter <= 'Z') return letter - 'A' + 1;
+    return -1;
+}
+
+bool TileSpriteCache::build(SDL_Renderer* renderer, int cellSize, const DrawSprite& drawSprite) {
+    invalidate();
+
+    // Columns are letters; rows are (variant, state) pairs
+    spriteSize = cellSize + 2 * MARGIN;
+    sheet = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                              LETTER_SLOTS * spriteSize, VARIANTS * STATES * spriteSize);
+    if (!sheet) {
+        LOG_WARN("Tile sprite sheet unavailable: " << SDL_GetError());
+        return false;
+    }
+    SDL_SetTextureBlendMode(sheet, SDL_BLENDMODE_BLEND);
+
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+    if (!SDL_SetRenderTarget(renderer, sheet)) {
+        invalidate();
+        return false;
+    }
+
+    SDL_BlendMode previousBlend = SDL_BLENDMODE_NONE;
+    SDL_GetRenderDrawBlendMode(renderer, &previousBlend);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+
+    for (int variant = 0; variant < VARIANTS; ++variant) {
+        for (int state = 0; state < STATES; ++state) {
+            for (int slot = 0; slot < LETTER_SLOTS; ++slot) {
+                const char letter = (slot == 0) ? ' ' : static_cast<char>('A' + slot - 1);
+                const bool blank = variant == 1 || slot == 0;
+                const int points = blank ? 0 : Tile::getPointsForLetter(letter);
+
+                const float x = static_cast<float>(slot * spriteSize + MARGIN);
+                const float y = static_cast<float>((variant * STATES + state) * spriteSize + MARGIN);
+                drawSprite(x, y, letter, points, static_cast<TileSpriteState>(state));
+            }
+        }
+    }
+
+    SDL_SetRenderDrawBlendMode(renderer, previousBlend);
+    SDL_SetRenderTarget(renderer, previousTarget);
+    return true;
+}
+
+void TileSpriteCache::invalidate() {
+    if (sheet) {
+        SDL_DestroyTexture(sheet);
+        sheet = nullptr;
+    }
+}
+
+bool TileSpriteCache::isReady() const {
+    return sheet != nullptr;
+}
+
+bool TileSpriteCache::draw(SDL_Renderer* renderer, float x, float y, char letter, int points, bool blank,
+                           TileSpriteState state) const {
+    SDL_FRect source, dest;
+    if (!locate(x, y, letter, points, blank, state, source, dest)) return false;
+    return SDL_RenderTexture(renderer, sheet, &source, &dest);
+}
+
+bool TileSpriteCache::locate(float x, float y, char letter, int points, bool blank, TileSpriteState state,
+                             SDL_FRect& source, SDL_FRect& dest) const {
+    const int slot = letterSlot(letter);
+    if (!sheet || slot < 0) return false;
+
+    blank = blank || slot == 0;
+    const int expectedPoints = blank ? 0 : Tile::getPointsForLetter(letter);
+    if (points != expectedPoints) return false;
+
+    const int variant = blank ? 1 : 0;
+    source = {
+        static_cast<float>(slot * spriteSize),
+        static_cast<float>((variant * STATES + static_cast<int>(state)) * spriteSize),
+        static_cast<float>(spriteSize), static_cast<float>(spriteSize)
+    };
+    dest = {x - MARGIN, y - MARGIN, static_cast<float>(spriteSize), static_cast<float>(spriteSize)};
+    return true;
+}
+
+SDL_Texture* TileSpriteCache::getTexture() const {
+    return sheet;
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <functional>
+
+enum class TileSpriteState : int {
+    PLACED = 0,
+    PENDING = 1,
+    SELECTED = 2
+};
+
+// Every tile face the game can show (unassigned blank + A-Z, with normal or
+// zero-point blank scoring, in each state) pre-rendered into one sheet, so a
+// tile is a single SDL_RenderTexture. The faces themselves are drawn by the
+// caller's callback, which keeps the look identical to direct drawing.
+class TileSpriteCache {
+public:
+    using DrawSprite = std::function<void(float x, float y, char letter, int points, TileSpriteState state)>;
+
+    static const int MARGIN = 6;      // room for the pending highlight and selection glow
+
+    TileSpriteCache();
+    ~TileSpriteCache();
+
+    TileSpriteCache(const TileSpriteCache&) = delete;
+    TileSpriteCache& operator=(const TileSpriteCache&) = delete;
+
+    bool build(SDL_Renderer* renderer, int cellSize, const DrawSprite& drawSprite);
+    void invalidate();
+    bool isReady() const;
+
+    // Returns false when the tile has no sprite (odd letter or custom points).
+    bool draw(SDL_Renderer* renderer, float x, float y, char letter, int points, bool blank,
+              TileSpriteState state) const;
+    // Same lookup for callers that batch the quad themselves.
+    bool locate(float x, float y, char letter, int points, bool blank, TileSpriteState state,
+                SDL_FRect& source, SDL_FRect& dest) const;
+    SDL_Texture* getTexture() const;
+
+private:
+    static const int LETTER_SLOTS = 27;
+    static const int VARIANTS = 2;
+    static const int STATES = 3;
+
+    SDL_Texture* sheet;
+    int spriteSize;
+
+    static int letterSlot(char letter);
+};
\ No newline at end of file
@@ -0,0 +1,464 @@
+#include "../src/Core/Game.hpp"
+#include "../src/Core/Gcg.hpp"
+#include "../src/Core/Logger.hpp"
+#include "../src/Core/MoveGenerator.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Microbenchmarks for the core hot paths. Inputs come from a fixed seed and
+// a few recorded board positions, so runs are comparable release to release.
+// Usage: scrabble_bench [--json results.json] [--filter text] [--min-time ms]
+//                       [--batches N] [word_list.txt]
+
+struct BenchmarkResult {
+    std::string name;
+    uint64_t iterations;      // per batch
+    double medianNsPerOp;
+    double minNsPerOp;
+    double maxNsPerOp;
+};
+
+struct Play {
+    const char* word;
+    int row;
+    int col;
+    bool horizontal;
+};
+
+struct RecordedPosition {
+    std::string name;
+    Board board;
+    std::vector<std::pair<int, int>> pendingTiles;
+};
+
+static const uint32_t BENCHMARK_SEED = 20240611;
+static const size_t SAMPLE_WORDS = 4096;
+
+// Results are folded in here so the optimiser cannot drop the work
+static volatile size_t benchmarkSink = 0;
+
+static void placePlay(Board& board, const Play& play, std::vector<std::pair<int, int>>* pendingTiles) {
+    for (size_t i = 0; play.word[i] != '\0'; ++i) {
+        const int row = play.horizontal ? play.row : play.row + static_cast<int>(i);
+        const int col = play.horizontal ? play.col + static_cast<int>(i) : play.col;
+        if (board.getTile(row, col)) continue;
+
+        board.placeTile(row, col, Tile(play.word[i]));
+        if (pendingTiles) pendingTiles->push_back({row, col});
+    }
+}
+
+static RecordedPosition recordPosition(const std::string& name, const std::vector<Play>& history, const Play& pending) {
+    RecordedPosition position;
+    position.name = name;
+    for (const Play& play : history) {
+        placePlay(position.board, play, nullptr);
+    }
+    placePlay(position.board, pending, &position.pendingTiles);
+    return position;
+}
+
+// A full game from the seeded bag: each turn lays a few of the mover's rack
+// tiles on the next free squares (replay does not look at words), with a
+// pass every fifth turn
+static GameRecord syntheticGame(uint32_t seed) {
+    GameRecord record;
+    record.seed = seed;
+    Game game;
+    int square = 0;
+    for (int turn = 0; turn < 40 && game.replayRecord(record); ++turn) {
+        const uint8_t mover = static_cast<uint8_t>(game.getCurrentPlayerIndex());
+        const std::vector<Tile>& rack = game.getCurrentPlayer().getRack();
+        if (turn % 5 == 4) {
+            record.moves.push_back({RecordedMoveType::PASS, mover, 0, 0, 0, {0}, {0}});
+            continue;
+        }
+        const int count = std::min<int>(static_cast<int>(rack.size()), 1 + turn % 4);
+        if (count == 0 || square + count > 15 * 15) break;
+
+        RecordedMove move = {RecordedMoveType::PLAY, mover, static_cast<uint8_t>(count), 0, 0, {0}, {0}};
+        for (int i = 0; i < count; ++i) {
+            if (rack[i].getIsBlank()) move.blankMask |= 1 << i;
+            move.squares[i] = static_cast<uint8_t>(square++);
+            move.letters[i] = rack[i].getLetter();
+            move.score = static_cast<int16_t>(move.score + rack[i].getPoints());
+        }
+        record.moves.push_back(move);
+    }
+    record.moves.push_back({RecordedMoveType::GAME_END, 0, 0, 0, 0, {0}, {0}});
+    return record;
+}
+
+// A tournament-style GCG archive: racks, one play per row down the board,
+// exchanges, a withdrawn phony and end-of-game rack points
+static std::string syntheticArchive(uint32_t seed, int games) {
+    std::mt19937 rng(seed);
+    const char* nicknames[2] = {"alice", "bob"};
+    std::string archive;
+    for (int g = 0; g < games; ++g) {
+        archive += "#character-encoding UTF-8\n#player1 alice Alice Example\n#player2 bob Bob Example\n";
+        int totals[2] = {0, 0};
+        for (int turn = 0; turn < 15; ++turn) {
+            const int p = turn % 2;
+            std::string rack;
+            for (int i = 0; i < 7; ++i) rack.push_back(static_cast<char>('A' + rng() % 26));
+            const std::string prefix = std::string(">") + nicknames[p] + ": " + rack + " ";
+
+            if (turn % 5 == 4) {
+                archive += prefix + "-" + rack.substr(0, 3) + " +0 " + std::to_string(totals[p]) + "\n";
+                continue;
+            }
+            std::string word = rack.substr(0, 2 + turn % 6);
+            if (turn % 4 == 1) word[1] = static_cast<char>(word[1] - 'A' + 'a');
+            const int score = 5 + static_cast<int>(rng() % 40);
+            totals[p] += score;
+            archive += prefix + std::to_string(turn + 1) + "A " + word + " +" + std::to_string(score) + " " +
+                       std::to_string(totals[p]) + "\n";
+            if (turn == 7) {
+                totals[p] -= score;
+                archive += prefix + "-- -" + std::to_string(score) + " " + std::to_string(totals[p]) + "\n";
+            }
+        }
+        totals[0] += 8;
+        archive += ">alice: (EQT) +8 " + std::to_string(totals[0]) + "\n";
+    }
+    return archive;
+}
+
+static std::vector<RecordedPosition> recordedPositions() {
+    return {
+        recordPosition("opening", {}, {"QUIZ", 7, 5, true}),
+        recordPosition("midgame", {
+            {"HOUSE", 7, 3, true}, {"HELLO", 7, 3, false}, {"SCRABBLE", 7, 6, false}
+        }, {"BEATS", 8, 2, true}),
+        recordPosition("endgame", {
+            {"HOUSE", 7, 3, true}, {"HELLO", 7, 3, false}, {"SCRABBLE", 7, 6, false},
+            {"OXEN", 11, 3, true}, {"LEAFY", 13, 2, true}, {"ZONE", 3, 7, false},
+            {"QUARTZ", 3, 2, true}, {"JOKE", 10, 9, false}
+        }, {"WAVES", 6, 8, false})
+    };
+}
+
+template <typename Body>
+static BenchmarkResult runBenchmark(const std::string& name, double minBatchSeconds, int batches, Body body) {
+    using Clock = std::chrono::steady_clock;
+    auto timeBatch = [&](uint64_t iterations) {
+        const auto start = Clock::now();
+        body(iterations);
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    // Grow the batch until it is long enough to time reliably
+    uint64_t iterations = 1;
+    double seconds = timeBatch(iterations);
+    while (seconds < minBatchSeconds && iterations < (1ULL << 32)) {
+        const double scale = seconds > 0.0 ? std::min(10.0, 1.2 * minBatchSeconds / seconds) : 10.0;
+        iterations = std::max<uint64_t>(iterations + 1, static_cast<uint64_t>(iterations * scale));
+        seconds = timeBatch(iterations);
+    }
+
+    std::vector<double> samples;
+    for (int b = 0; b < batches; ++b) {
+        samples.push_back(timeBatch(iterations) * 1e9 / iterations);
+    }
+    std::sort(samples.begin(), samples.end());
+    return {name, iterations, samples[samples.size() / 2], samples.front(), samples.back()};
+}
+
+static std::string jsonEscape(const std::string& text) {
+    std::string escaped;
+    for (char c : text) {
+        if (c == '"' || c == '\\') escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+static bool writeJson(const std::string& filename, const std::string& wordList, size_t wordCount,
+                      const std::vector<BenchmarkResult>& results) {
+    std::ofstream out(filename, std::ios::trunc);
+    if (!out.is_open()) {
+        std::cerr << "Error opening benchmark output: " << filename << std::endl;
+        return false;
+    }
+
+    out << std::fixed << std::setprecision(3);
+    out << "{\n";
+    out << "  \"schema\": 1,\n";
+    out << "  \"seed\": " << BENCHMARK_SEED << ",\n";
+    out << "  \"word_list\": \"" << jsonEscape(wordList) << "\",\n";
+    out << "  \"word_count\": " << wordCount << ",\n";
+    out << "  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchmarkResult& result = results[i];
+        out << "    {\"name\": \"" << result.name << "\", \"iterations\": " << result.iterations
+            << ", \"ns_per_op\": " << result.medianNsPerOp
+            << ", \"min_ns_per_op\": " << result.minNsPerOp
+            << ", \"max_ns_per_op\": " << result.maxNsPerOp << "}"
+            << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n";
+    out << "}\n";
+
+    if (!out) {
+        std::cerr << "Error writing benchmark output: " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    std::string jsonFile;
+    std::string filter;
+    std::string wordList = "src/Constant/enable1.txt";
+    double minBatchSeconds = 0.2;
+    int batches = 5;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--json" && i + 1 < argc) {
+            jsonFile = argv[++i];
+        } else if (arg == "--filter" && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (arg == "--min-time" && i + 1 < argc) {
+            minBatchSeconds = std::max(1, std::atoi(argv[++i])) / 1000.0;
+        } else if (arg == "--batches" && i + 1 < argc) {
+            batches = std::max(1, std::atoi(argv[++i]));
+        } else if (!arg.empty() && arg[0] != '-') {
+            wordList = arg;
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--json results.json] [--filter text] [--min-time ms] [--batches N] [word_list.txt]"
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    // Cases load dictionaries and replay games over and over; keep their
+    // informational logging out of the timings and the report
+    Logger::instance().setLevel(LogLevel::WARN);
+
+    Dictionary dictionary;
+    if (!dictionary.loadFromFile(wordList)) {
+        std::cerr << "Failed to load word list: " << wordList << std::endl;
+        return 1;
+    }
+
+    // Fixed-seed query sets: real words, random letter strings that are not
+    // words, and two- and three-letter prefixes of the real words
+    std::mt19937 rng(BENCHMARK_SEED);
+    WordPattern anyWord;
+    WordPattern::parse("*", anyWord);
+    std::vector<std::string> allWords;
+    dictionary.matchPattern(anyWord, allWords);
+    if (allWords.empty()) {
+        std::cerr << "Word list has no words: " << wordList << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> hits, misses, prefixes;
+    std::uniform_int_distribution<size_t> pickWord(0, allWords.size() - 1);
+    std::uniform_int_distribution<int> pickLetter('A', 'Z');
+    std::uniform_int_distribution<int> pickLength(2, 8);
+    while (hits.size() < SAMPLE_WORDS) {
+        hits.push_back(allWords[pickWord(rng)]);
+        prefixes.push_back(hits.back().substr(0, hits.size() % 2 ? 2 : 3));
+    }
+    while (misses.size() < SAMPLE_WORDS) {
+        std::string word(pickLength(rng), 'A');
+        for (char& c : word) c = static_cast<char>(pickLetter(rng));
+        if (!dictionary.isValidWord(word)) misses.push_back(word);
+    }
+    allWords.clear();
+    allWords.shrink_to_fit();
+
+    const std::vector<RecordedPosition> positions = recordedPositions();
+    Player player("Bench");
+    for (char letter : std::string("AEINRST")) {
+        player.addTileToRack(Tile(letter));
+    }
+    const std::vector<Tile> placementTiles = {Tile('C'), Tile('A'), Tile('T')};
+
+    std::vector<std::pair<std::string, std::function<void(uint64_t)>>> cases;
+    cases.push_back({"dictionary/load_from_file", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) {
+            Dictionary loaded;
+            loaded.loadFromFile(wordList);
+            benchmarkSink += loaded.getWordCount();
+        }
+    }});
+    cases.push_back({"dictionary/is_valid_word_hit", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) benchmarkSink += dictionary.isValidWord(hits[i % hits.size()]);
+    }});
+    cases.push_back({"dictionary/is_valid_word_miss", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) benchmarkSink += dictionary.isValidWord(misses[i % misses.size()]);
+    }});
+    cases.push_back({"dictionary/get_suggestions", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) benchmarkSink += dictionary.getSuggestions(prefixes[i % prefixes.size()]).size();
+    }});
+    cases.push_back({"player/can_form_word", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) benchmarkSink += player.canFormWord(hits[i % hits.size()]);
+    }});
+    cases.push_back({"tile_bag/setup_and_draw", [&](uint64_t n) {
+        Game game;
+        for (uint64_t i = 0; i < n; ++i) {
+            game.setupGame(GameMode::HUMAN_VS_HUMAN, "A", "B");
+            benchmarkSink += game.getTileBagSize();
+        }
+    }});
+
+    std::vector<GameRecord> games;
+    std::vector<uint8_t> gameBytes;
+    for (uint32_t i = 0; i < 64; ++i) {
+        games.push_back(syntheticGame(BENCHMARK_SEED + i));
+        games.back().appendTo(gameBytes);
+    }
+    cases.push_back({"game_record/parse", [&](uint64_t n) {
+        GameRecord parsed;
+        size_t offset = 0;
+        for (uint64_t i = 0; i < n; ++i) {
+            if (offset >= gameBytes.size()) offset = 0;
+            benchmarkSink += GameRecord::parse(gameBytes.data(), gameBytes.size(), offset, parsed);
+        }
+    }});
+    cases.push_back({"game_record/replay", [&](uint64_t n) {
+        Game game;
+        for (uint64_t i = 0; i < n; ++i) {
+            benchmarkSink += game.replayRecord(games[i % games.size()]);
+            benchmarkSink += game.getBoard().isEmpty();
+        }
+    }});
+
+    // Mid-game: half of a synthetic game's moves
+    Game savedSource;
+    GameRecord halfGame = games[0];
+    halfGame.moves.resize(halfGame.moves.size() / 2);
+    savedSource.replayRecord(halfGame);
+    std::vector<uint8_t> savedBytes;
+    SavedGame midGame;
+    savedSource.captureGame(midGame);
+    midGame.appendTo(savedBytes);
+    const std::string saveFile = (std::filesystem::temp_directory_path() / "scrabble_bench.sav").string();
+    cases.push_back({"saved_game/capture", [&](uint64_t n) {
+        SavedGame saved;
+        std::vector<uint8_t> bytes;
+        for (uint64_t i = 0; i < n; ++i) {
+            bytes.clear();
+            savedSource.captureGame(saved);
+            saved.appendTo(bytes);
+            benchmarkSink += bytes.size();
+        }
+    }});
+    cases.push_back({"saved_game/restore", [&](uint64_t n) {
+        Game game;
+        SavedGame saved;
+        for (uint64_t i = 0; i < n; ++i) {
+            benchmarkSink += SavedGame::parse(savedBytes.data(), savedBytes.size(), saved);
+            benchmarkSink += game.restoreGame(saved);
+        }
+    }});
+    cases.push_back({"saved_game/save_file", [&](uint64_t n) {
+        for (uint64_t i = 0; i < n; ++i) benchmarkSink += savedSource.saveGame(saveFile);
+    }});
+
+    const std::string archive = syntheticArchive(BENCHMARK_SEED, 64);
+    cases.push_back({"gcg/read_game", [&](uint64_t n) {
+        GcgGame parsed;
+        for (uint64_t i = 0; i < n;) {
+            std::istringstream input(archive);
+            GcgReader reader(input);
+            for (; i < n && reader.readGame(parsed); ++i) benchmarkSink += parsed.moves.size();
+        }
+    }});
+    cases.push_back({"gcg/to_record", [&](uint64_t n) {
+        std::istringstream input(archive);
+        GcgReader reader(input);
+        GcgGame parsed;
+        reader.readGame(parsed);
+        GameRecord converted;
+        std::vector<uint8_t> bytes;
+        for (uint64_t i = 0; i < n; ++i) {
+            bytes.clear();
+            benchmarkSink += parsed.toRecord(converted);
+            converted.appendTo(bytes);
+            benchmarkSink += bytes.size();
+        }
+    }});
+    cases.push_back({"gcg/write_game", [&](uint64_t n) {
+        std::istringstream input(archive);
+        GcgReader reader(input);
+        GcgGame parsed;
+        reader.readGame(parsed);
+        std::ostringstream output;
+        GcgWriter writer(output);
+        for (uint64_t i = 0; i < n; ++i) {
+            output.str(std::string());
+            benchmarkSink += writer.writeGame(parsed);
+        }
+    }});
+
+    for (const RecordedPosition& position : positions) {
+        cases.push_back({"board/is_valid_placement/" + position.name, [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; ++i) {
+                const int cell = static_cast<int>(i % 225);
+                benchmarkSink += position.board.isValidPlacement(cell / 15, cell % 15, placementTiles,
+                                                                 (i & 1) ? "HORIZONTAL" : "VERTICAL");
+            }
+        }});
+        cases.push_back({"board/calculate_word_score/" + position.name, [&](uint64_t n) {
+            for (uint64_t i = 0; i < n; ++i) {
+                const int row = static_cast<int>(i % 15);
+                benchmarkSink += position.board.calculateWordScore(row, 0, "SCRABBLE", "HORIZONTAL");
+            }
+        }});
+        cases.push_back({"game/find_all_words_formed/" + position.name, [&](uint64_t n) {
+            Game game;
+            game.loadPosition(position.board, position.pendingTiles);
+            for (uint64_t i = 0; i < n; ++i) benchmarkSink += game.findAllWordsFormed().size();
+        }});
+        cases.push_back({"game/calculate_word_score/" + position.name, [&](uint64_t n) {
+            Game game;
+            game.loadPosition(position.board, position.pendingTiles);
+            const std::vector<WordInfo> words = game.findAllWordsFormed();
+            for (uint64_t i = 0; i < n; ++i) {
+                for (const WordInfo& word : words) benchmarkSink += game.calculateWordScore(word);
+            }
+        }});
+        cases.push_back({"move_generator/generate/" + position.name, [&](uint64_t n) {
+            MoveGenerator generator(dictionary);
+            std::vector<GeneratedMove> moves;
+            for (uint64_t i = 0; i < n; ++i) {
+                benchmarkSink += generator.generate(position.board, player.getRack(), moves);
+            }
+        }});
+    }
+
+    std::vector<BenchmarkResult> results;
+    for (const auto& benchmark : cases) {
+        if (!filter.empty() && benchmark.first.find(filter) == std::string::npos) continue;
+
+        results.push_back(runBenchmark(benchmark.first, minBatchSeconds, batches, benchmark.second));
+        const BenchmarkResult& result = results.back();
+        std::cout << std::left << std::setw(48) << result.name << std::right << std::fixed
+                  << std::setprecision(1) << std::setw(14) << result.medianNsPerOp << " ns/op"
+                  << "  (min " << result.minNsPerOp << ", max " << result.maxNsPerOp
+                  << ", " << result.iterations << " iterations)" << std::endl;
+    }
+
+    if (!jsonFile.empty() && !writeJson(jsonFile, wordList, dictionary.getWordCount(), results)) {
+        return 1;
+    }
+    return 0;
+}
\ No newline at end of file
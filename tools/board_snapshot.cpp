@@ -0,0 +1,213 @@
+#include "../src/UI/OffscreenRenderer.hpp"
+#include <SDL3_image/SDL_image.h>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Renders board positions to PNG files without a window.
+// Usage: scrabble_snapshot <positions.txt> <output_dir> [--font file.ttf] [--threads N]
+//
+// Each non-empty line of the positions file is one board: 225 characters in
+// row-major order ('.' empty, A-Z a tile, a-z a blank played as that letter),
+// optionally followed by whitespace and a name for the image (a plain file
+// name; anything with "/", "\\" or ".." is replaced). Lines starting
+// with '#' are comments.
+
+struct Position {
+    std::string name;
+    std::string cells;
+};
+
+struct PendingImage {
+    SDL_Surface* surface;
+    std::string filename;
+};
+
+static const size_t BOARD_CELLS = 15 * 15;
+static const size_t MAX_PENDING = 64;
+
+static bool loadPositions(const std::string& filename, std::vector<Position>& positions) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Error opening positions file: " << filename << std::endl;
+        return false;
+    }
+
+    std::string line;
+    size_t lineNumber = 0;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        if (line.empty() || line[0] == '#') continue;
+
+        std::istringstream fields(line);
+        Position position;
+        fields >> position.cells >> position.name;
+        if (position.cells.empty()) continue;
+
+        const bool valid = position.cells.size() == BOARD_CELLS &&
+            std::all_of(position.cells.begin(), position.cells.end(), [](char c) {
+                return c == '.' || std::isalpha(static_cast<unsigned char>(c));
+            });
+        if (!valid) {
+            std::cerr << filename << ":" << lineNumber << ": expected 225 board characters" << std::endl;
+            return false;
+        }
+        // The name becomes a file name inside the output directory; anything
+        // that could point outside it gets a generated name instead
+        const bool unsafeName = position.name.find_first_of("/\\") != std::string::npos ||
+                                position.name.find("..") != std::string::npos;
+        if (unsafeName) {
+            std::cerr << filename << ":" << lineNumber << ": ignoring unsafe image name " << position.name
+                      << std::endl;
+        }
+        if (position.name.empty() || unsafeName) {
+            std::ostringstream name;
+            name << "position_" << positions.size();
+            position.name = name.str();
+        }
+        positions.push_back(std::move(position));
+    }
+    return true;
+}
+
+static void fillBoard(const Position& position, Board& board) {
+    board.clear();
+    for (size_t i = 0; i < BOARD_CELLS; ++i) {
+        const char c = position.cells[i];
+        if (c == '.') continue;
+
+        const int row = static_cast<int>(i / 15);
+        const int col = static_cast<int>(i % 15);
+        if (std::islower(static_cast<unsigned char>(c))) {
+            board.placeTile(row, col, Tile(c, 0));
+        } else {
+            board.placeTile(row, col, Tile(c));
+        }
+    }
+}
+
+static int printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " <positions.txt> <output_dir> [--font file.ttf] [--threads N]"
+              << std::endl;
+    return 1;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3) {
+        return printUsage(argv[0]);
+    }
+
+    const std::string positionsFile = argv[1];
+    const std::string outputDir = argv[2];
+    std::string fontPath;
+    unsigned int threadCount = std::max(1u, std::thread::hardware_concurrency());
+    for (int i = 3; i < argc; ++i) {
+        const std::string option = argv[i];
+        if (option == "--font" && i + 1 < argc) {
+            fontPath = argv[++i];
+        } else if (option == "--threads" && i + 1 < argc) {
+            threadCount = static_cast<unsigned int>(std::max(1, std::atoi(argv[++i])));
+        } else {
+            std::cerr << "Unknown option or missing value: " << option << std::endl;
+            return printUsage(argv[0]);
+        }
+    }
+
+    std::vector<Position> positions;
+    if (!loadPositions(positionsFile, positions)) {
+        return 1;
+    }
+
+    if (!OffscreenRenderer::initializeHeadless()) {
+        return 1;
+    }
+
+    int failures = 0;
+    {
+        OffscreenRenderer offscreen;
+        if (!offscreen.initialize(fontPath)) {
+            OffscreenRenderer::shutdownHeadless();
+            return 1;
+        }
+
+        // The software renderer is single threaded; PNG encoding is the slow
+        // part, so finished boards are handed to a pool of encoder threads
+        std::mutex queueMutex;
+        std::condition_variable queueChanged;
+        std::deque<PendingImage> pending;
+        bool finished = false;
+
+        std::vector<std::thread> encoders;
+        std::vector<int> encoderFailures(threadCount, 0);
+        for (unsigned int t = 0; t < threadCount; ++t) {
+            encoders.emplace_back([&, t]() {
+                for (;;) {
+                    PendingImage image;
+                    {
+                        std::unique_lock<std::mutex> lock(queueMutex);
+                        queueChanged.wait(lock, [&]() { return finished || !pending.empty(); });
+                        if (pending.empty()) return;
+                        image = pending.front();
+                        pending.pop_front();
+                    }
+                    queueChanged.notify_all();
+
+                    if (!IMG_SavePNG(image.surface, image.filename.c_str())) {
+                        std::cerr << "Could not write " << image.filename << ": " << SDL_GetError() << std::endl;
+                        ++encoderFailures[t];
+                    }
+                    SDL_DestroySurface(image.surface);
+                }
+            });
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        Board board;
+        for (const auto& position : positions) {
+            fillBoard(position, board);
+            SDL_Surface* snapshot = offscreen.renderBoard(board);
+            if (!snapshot) {
+                std::cerr << "Board snapshot failed for " << position.name << ": " << SDL_GetError() << std::endl;
+                ++failures;
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueChanged.wait(lock, [&]() { return pending.size() < MAX_PENDING; });
+            pending.push_back({snapshot, outputDir + "/" + position.name + ".png"});
+            lock.unlock();
+            queueChanged.notify_all();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            finished = true;
+        }
+        queueChanged.notify_all();
+        for (auto& encoder : encoders) {
+            encoder.join();
+        }
+        for (int count : encoderFailures) {
+            failures += count;
+        }
+
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "Rendered " << positions.size() - failures << " of " << positions.size() << " positions in "
+                  << seconds << " s (" << (seconds > 0.0 ? positions.size() / seconds : 0.0) << " per second)"
+                  << std::endl;
+    }
+
+    OffscreenRenderer::shutdownHeadless();
+    return failures == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include "../src/Core/Dictionary.hpp"
+#include "../src/Core/Logger.hpp"
+#include "../src/Server/GameServer.hpp"
+#include <csignal>
+#include <cstdlib>
+#include <string>
+#include <sys/resource.h>
+#include <vector>
+
+// Headless match server. Usage:
+//     scrabble_server [--port n] [--unix path] [--lexicon file.lex] [word_list.txt ...]
+// Serves TCP on port 7070 unless only --unix is given; --port 0 picks a free
+// port. Runs until SIGINT or SIGTERM.
+
+static GameServer* activeServer = nullptr;
+
+static void handleSignal(int) {
+    if (activeServer) activeServer->stop();
+}
+
+int main(int argc, char* argv[])
+{
+    int port = -1;
+    std::string unixPath;
+    std::string lexiconFile;
+    std::vector<std::string> wordLists;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--port" && i + 1 < argc) {
+            port = std::atoi(argv[++i]);
+        } else if (arg == "--unix" && i + 1 < argc) {
+            unixPath = argv[++i];
+        } else if (arg == "--lexicon" && i + 1 < argc) {
+            lexiconFile = argv[++i];
+        } else if (arg.compare(0, 2, "--") != 0) {
+            wordLists.push_back(arg);
+        } else {
+            LOG_ERROR("Usage: " << argv[0] << " [--port n] [--unix path] [--lexicon file.lex] [word_list.txt ...]");
+            Logger::instance().shutdown();
+            return 1;
+        }
+    }
+    if (port < 0 && unixPath.empty()) port = 7070;
+    if (wordLists.empty()) {
+        wordLists = {"src/Constant/word_bank.txt", "src/Constant/enable1.txt"};
+    }
+
+    Dictionary dictionary;
+    const bool loaded = !lexiconFile.empty() ? dictionary.loadFromLexicon(lexiconFile)
+                                             : dictionary.loadFromFiles(wordLists);
+    if (!loaded) {
+        LOG_ERROR("Failed to load the lexicon");
+        Logger::instance().shutdown();
+        return 1;
+    }
+
+    // Two sockets per match: thousands of matches need more than the usual 1024
+    rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+
+    GameServer server(dictionary);
+    if ((port >= 0 && !server.listenTcp(static_cast<uint16_t>(port))) ||
+        (!unixPath.empty() && !server.listenUnix(unixPath))) {
+        Logger::instance().shutdown();
+        return 1;
+    }
+
+    activeServer = &server;
+    std::signal(SIGINT, handleSignal);
+    std::signal(SIGTERM, handleSignal);
+    const bool served = server.run();
+    activeServer = nullptr;
+
+    Logger::instance().shutdown();
+    return served ? 0 : 1;
+}
\ No newline at end of file
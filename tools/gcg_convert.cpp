@@ -0,0 +1,114 @@
+#include "../src/Core/Gcg.hpp"
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Converts between GCG game archives and binary game records.
+// Usage: scrabble_gcg <archive.gcg> [output.scrb]
+//        scrabble_gcg --export <records.scrb> <output.gcg>
+//
+// Archives are read one game at a time and records are written in batches,
+// so a corpus of any size runs in constant memory.
+
+static const size_t FLUSH_BYTES = 1 << 20;
+
+static bool flushRecords(std::ofstream& output, std::vector<uint8_t>& bytes) {
+    output.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    bytes.clear();
+    return static_cast<bool>(output);
+}
+
+static int importArchive(const std::string& inputFile, const std::string& outputFile) {
+    std::ifstream input(inputFile);
+    if (!input.is_open()) {
+        std::cerr << "Error opening GCG archive: " << inputFile << std::endl;
+        return 1;
+    }
+
+    std::ofstream output;
+    if (!outputFile.empty()) {
+        output.open(outputFile, std::ios::binary | std::ios::trunc);
+        if (!output.is_open()) {
+            std::cerr << "Error opening record file: " << outputFile << std::endl;
+            return 1;
+        }
+    }
+
+    GcgReader reader(input);
+    GcgGame game;
+    GameRecord record;
+    std::vector<uint8_t> bytes;
+    size_t games = 0;
+    size_t moves = 0;
+    size_t unconverted = 0;
+    while (reader.readGame(game)) {
+        ++games;
+        moves += game.moves.size();
+        if (!output.is_open()) continue;
+
+        if (!game.toRecord(record)) {
+            ++unconverted;
+            continue;
+        }
+        record.appendTo(bytes);
+        if (bytes.size() >= FLUSH_BYTES && !flushRecords(output, bytes)) {
+            std::cerr << "Error writing record file: " << outputFile << std::endl;
+            return 1;
+        }
+    }
+    if (output.is_open() && !flushRecords(output, bytes)) {
+        std::cerr << "Error writing record file: " << outputFile << std::endl;
+        return 1;
+    }
+
+    std::cout << "Read " << games << " games (" << moves << " moves) from " << reader.getLineNumber()
+              << " lines; skipped " << reader.getSkippedGames() << " malformed";
+    if (output.is_open()) std::cout << ", " << unconverted << " not convertible";
+    std::cout << std::endl;
+    return 0;
+}
+
+static int exportRecords(const std::string& inputFile, const std::string& outputFile) {
+    std::vector<GameRecord> records;
+    if (!GameRecord::readFile(inputFile, records)) return 1;
+
+    std::ofstream output(outputFile, std::ios::trunc);
+    if (!output.is_open()) {
+        std::cerr << "Error opening GCG file: " << outputFile << std::endl;
+        return 1;
+    }
+
+    GcgWriter writer(output);
+    GcgGame game;
+    size_t written = 0;
+    for (const GameRecord& record : records) {
+        if (!GcgGame::fromRecord(record, game)) {
+            std::cerr << "Skipping inconsistent record " << written << std::endl;
+            continue;
+        }
+        if (!writer.writeGame(game)) {
+            std::cerr << "Error writing GCG file: " << outputFile << std::endl;
+            return 1;
+        }
+        ++written;
+    }
+
+    std::cout << "Wrote " << written << " of " << records.size() << " games to " << outputFile << std::endl;
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    const std::string mode = argc > 1 ? argv[1] : "";
+    if (mode == "--export" && argc == 4) {
+        return exportRecords(argv[2], argv[3]);
+    }
+    if (argc == 2 || (argc == 3 && mode != "--export")) {
+        return importArchive(argv[1], argc == 3 ? argv[2] : "");
+    }
+
+    std::cerr << "Usage: " << argv[0] << " <archive.gcg> [output.scrb]\n"
+              << "       " << argv[0] << " --export <records.scrb> <output.gcg>" << std::endl;
+    return 1;
+}
\ No newline at end of file
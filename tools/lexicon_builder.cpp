@@ -0,0 +1,41 @@
+#include "../src/Core/Dictionary.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Offline generator for the perfect hash lexicon used by membership-only
+// deployments. Usage: scrabble_lexicon <output.lex> [word_list.txt ...]
+int main(int argc, char* argv[])
+{
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <output.lex> [word_list.txt ...]" << std::endl;
+        return 1;
+    }
+
+    const std::string outputFile = argv[1];
+    std::vector<std::string> inputFiles(argv + 2, argv + argc);
+    if (inputFiles.empty()) {
+        inputFiles = {"src/Constant/word_bank.txt", "src/Constant/enable1.txt"};
+    }
+
+    Dictionary dictionary;
+    if (!dictionary.loadFromFiles(inputFiles)) {
+        std::cerr << "Failed to load word lists" << std::endl;
+        return 1;
+    }
+
+    if (!dictionary.saveLexicon(outputFile)) {
+        std::cerr << "Failed to write lexicon: " << outputFile << std::endl;
+        return 1;
+    }
+
+    // Read the table back so a broken file never ships
+    Dictionary check;
+    if (!check.loadFromLexicon(outputFile) || check.getWordCount() != dictionary.getWordCount()) {
+        std::cerr << "Lexicon verification failed: " << outputFile << std::endl;
+        return 1;
+    }
+
+    std::cout << "Wrote " << outputFile << std::endl;
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,403 @@
+#include "../src/Core/Dictionary.hpp"
+#include "../src/Core/Gcg.hpp"
+#include "../src/Core/Logger.hpp"
+#include "../src/Core/Rules.hpp"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Referee for recorded games. Usage:
+//     scrabble_referee [--threads n] [--lexicon file.lex | --words list.txt ...]
+//                      [--bingo-bonus n] [--output results.tsv] [archive.gcg ... | -]
+// Replays every claimed play of every game on a fresh board and checks it
+// against the board rules and the lexicon, writing one tab-separated line
+// per move:
+//     game  move  player  position  word  verdict  computed  claimed  detail
+// Archives are streamed (stdin when none is given) and games are judged in
+// parallel; the output stays in input order. The bingo bonus defaults to 0
+// to match this game's scoring; use 50 for tournament archives.
+// Exits 0 for a clean archive, 2 when a play failed or a game could not be
+// replayed at all, and 1 on I/O errors.
+
+enum class Verdict {
+    OK,
+    SCORE_MISMATCH,     // legal play, but the claimed score is wrong
+    PHONY,              // forms a word missing from the lexicon
+    WORD_MISMATCH,      // the tiles form a different main word than claimed
+    NOT_IN_RACK,        // played a tile the claimed rack does not hold
+    BAD_PLACEMENT,
+    NOT_A_PLAY,         // passes, exchanges, withdrawals and end-of-game lines
+    COUNT
+};
+
+static const char* const VERDICT_NAMES[] = {
+    "OK", "SCORE_MISMATCH", "PHONY", "WORD_MISMATCH", "NOT_IN_RACK", "BAD_PLACEMENT", "-"
+};
+
+static const size_t VERDICT_COUNT = static_cast<size_t>(Verdict::COUNT);
+
+// Caps the games read ahead of the next one to print, so a slow game cannot
+// make the reorder buffer grow with the archive
+static const size_t MAX_IN_FLIGHT = 1024;
+
+static const char* describeMove(GcgMoveType type) {
+    switch (type) {
+        case GcgMoveType::PLAY:             return "play";
+        case GcgMoveType::PASS:             return "pass";
+        case GcgMoveType::EXCHANGE:         return "exchange";
+        case GcgMoveType::WITHDRAWN:        return "withdrawn";
+        case GcgMoveType::CHALLENGE_BONUS:  return "challenge bonus";
+        case GcgMoveType::END_RACK_POINTS:  return "end rack points";
+        case GcgMoveType::END_RACK_PENALTY: return "end rack penalty";
+        case GcgMoveType::TIME_PENALTY:     return "time penalty";
+    }
+    return "unknown";
+}
+
+// Judges games one at a time on its own board; one per worker thread.
+class Referee {
+private:
+    const Dictionary& dictionary;
+    const int bingoBonus;
+    Board board;
+    std::vector<std::pair<int, int>> lastPlay;
+
+    Verdict judgePlay(const GcgMove& move, int& computed, std::string& detail) {
+        const std::vector<std::pair<int, int>>& positions = move.word.newTilePositions;
+        for (size_t i = 0; i < positions.size(); ++i) {
+            const char letter = move.tiles[i];
+            Tile tile(letter);
+            if (std::islower(static_cast<unsigned char>(letter)) || letter == '?') {
+                tile = Tile();
+                if (letter != '?') tile.setLetter(letter);
+            }
+            board.placeTile(positions[i].first, positions[i].second, tile);
+        }
+        // A play stays on the board until a "--" line withdraws it, phony or not
+        lastPlay = positions;
+
+        const PlacementError error = Rules::checkPlacement(board, positions);
+        if (error != PlacementError::NONE) {
+            detail = Rules::describe(error);
+            return Verdict::BAD_PLACEMENT;
+        }
+
+        const std::vector<WordInfo> words = Rules::findAllWordsFormed(board, positions);
+        computed = 0;
+        for (const WordInfo& word : words) {
+            computed += Rules::calculateWordScore(board, word);
+        }
+        if (positions.size() == static_cast<size_t>(Rules::RACK_SIZE)) computed += bingoBonus;
+
+        if (!move.rack.empty()) {
+            int counts[UINT8_MAX + 1] = {0};
+            for (char tile : move.rack) ++counts[static_cast<unsigned char>(std::toupper(static_cast<unsigned char>(tile)))];
+            for (char letter : move.tiles) {
+                const bool blank = std::islower(static_cast<unsigned char>(letter)) || letter == '?';
+                if (--counts[static_cast<unsigned char>(blank ? '?' : letter)] < 0) {
+                    detail = std::string("no ") + (blank ? "blank" : std::string(1, letter)) + " in " + move.rack;
+                    return Verdict::NOT_IN_RACK;
+                }
+            }
+        }
+
+        const bool claimedFound = std::any_of(words.begin(), words.end(), [&](const WordInfo& word) {
+            return word.isHorizontal == move.word.isHorizontal && word.startRow == move.word.startRow &&
+                   word.startCol == move.word.startCol && word.word == move.word.word;
+        });
+        if (!claimedFound) {
+            detail = "forms";
+            for (const WordInfo& word : words) detail += " " + word.word;
+            if (words.empty()) detail = "forms no word";
+            return Verdict::WORD_MISMATCH;
+        }
+
+        for (const WordInfo& word : words) {
+            if (!dictionary.isValidWord(word.word)) {
+                detail += detail.empty() ? "not in lexicon: " : ",";
+                detail += word.word;
+            }
+        }
+        if (!detail.empty()) return Verdict::PHONY;
+
+        if (computed != move.score) {
+            detail = "claimed " + std::to_string(move.score);
+            return Verdict::SCORE_MISMATCH;
+        }
+        return Verdict::OK;
+    }
+
+public:
+    Referee(const Dictionary& dictionary, int bingoBonus) : dictionary(dictionary), bingoBonus(bingoBonus) {}
+
+    // Appends the game's result lines to output and tallies its verdicts.
+    void judgeGame(size_t gameNumber, const GcgGame& game, std::string& output, uint64_t tally[]) {
+        board.clear();
+        lastPlay.clear();
+
+        for (size_t m = 0; m < game.moves.size(); ++m) {
+            const GcgMove& move = game.moves[m];
+            Verdict verdict = Verdict::NOT_A_PLAY;
+            int computed = 0;
+            std::string detail;
+
+            if (move.type == GcgMoveType::PLAY) {
+                verdict = judgePlay(move, computed, detail);
+            } else {
+                if (move.type == GcgMoveType::WITHDRAWN) {
+                    for (const auto& pos : lastPlay) board.removeTile(pos.first, pos.second);
+                    lastPlay.clear();
+                }
+                detail = describeMove(move.type);
+            }
+            ++tally[static_cast<size_t>(verdict)];
+
+            const bool isPlay = move.type == GcgMoveType::PLAY;
+            const std::string& nickname = game.nicknames[move.player];
+            output += std::to_string(gameNumber);
+            output += '\t';
+            output += std::to_string(m + 1);
+            output += '\t';
+            output += nickname.empty() ? "player" + std::to_string(move.player + 1) : nickname;
+            output += '\t';
+            output += isPlay ? GcgWriter::formatPosition(move.word) : "-";
+            output += '\t';
+            output += isPlay ? move.word.word : (move.tiles.empty() ? "-" : move.tiles);
+            output += '\t';
+            output += VERDICT_NAMES[static_cast<size_t>(verdict)];
+            output += '\t';
+            output += (isPlay && verdict != Verdict::BAD_PLACEMENT) ? std::to_string(computed) : "-";
+            output += '\t';
+            output += std::to_string(move.score);
+            output += '\t';
+            output += detail;
+            output += '\n';
+        }
+    }
+};
+
+// Worker threads judging whole games. Results are handed back by game index
+// so the caller can print them in the order they were read.
+class RefereePool {
+private:
+    struct Job {
+        size_t index;
+        GcgGame game;
+    };
+
+    std::mutex mutex;
+    std::condition_variable jobReady;
+    std::condition_variable resultReady;
+    std::deque<Job> jobs;
+    std::map<size_t, std::string> results;
+    bool closing;
+    std::vector<std::thread> workers;
+    std::vector<std::vector<uint64_t>> tallies;
+
+    void work(const Dictionary& dictionary, int bingoBonus, std::vector<uint64_t>& tally) {
+        Referee referee(dictionary, bingoBonus);
+        for (;;) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                jobReady.wait(lock, [&]() { return closing || !jobs.empty(); });
+                if (jobs.empty()) return;
+                job = std::move(jobs.front());
+                jobs.pop_front();
+            }
+
+            std::string output;
+            referee.judgeGame(job.index + 1, job.game, output, tally.data());
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                results.emplace(job.index, std::move(output));
+            }
+            resultReady.notify_one();
+        }
+    }
+
+public:
+    RefereePool(const Dictionary& dictionary, int bingoBonus, unsigned int threadCount)
+        : closing(false), tallies(threadCount, std::vector<uint64_t>(VERDICT_COUNT, 0)) {
+        for (unsigned int t = 0; t < threadCount; ++t) {
+            workers.emplace_back(&RefereePool::work, this, std::cref(dictionary), bingoBonus, std::ref(tallies[t]));
+        }
+    }
+
+    ~RefereePool() {
+        finish();
+    }
+
+    void submit(size_t index, GcgGame&& game) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            jobs.push_back(Job{index, std::move(game)});
+        }
+        jobReady.notify_one();
+    }
+
+    // Writes every finished game whose turn has come and advances next; with
+    // wait set, blocks until at least the next game is done.
+    bool writeFinished(std::ostream& output, size_t& next, bool wait) {
+        std::vector<std::string> ready;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (wait) resultReady.wait(lock, [&]() { return results.count(next) != 0; });
+            for (auto it = results.begin(); it != results.end() && it->first == next; it = results.erase(it)) {
+                ready.push_back(std::move(it->second));
+                ++next;
+            }
+        }
+        for (const std::string& lines : ready) output << lines;
+        return static_cast<bool>(output);
+    }
+
+    void finish() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            closing = true;
+        }
+        jobReady.notify_all();
+        for (auto& worker : workers) {
+            if (worker.joinable()) worker.join();
+        }
+    }
+
+    // Only meaningful after finish()
+    uint64_t getTally(Verdict verdict) const {
+        uint64_t total = 0;
+        for (const auto& tally : tallies) total += tally[static_cast<size_t>(verdict)];
+        return total;
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    // Archives often arrive on stdin, which is far slower tied to stdio. This
+    // must come before any stream I/O; the logger is held at WARN below, so
+    // its stdio output only ever goes to stderr.
+    std::ios::sync_with_stdio(false);
+
+    unsigned int threadCount = std::max(1u, std::thread::hardware_concurrency());
+    int bingoBonus = 0;
+    std::string lexiconFile;
+    std::string outputFile;
+    std::vector<std::string> wordLists;
+    std::vector<std::string> archives;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--threads" && i + 1 < argc) {
+            threadCount = static_cast<unsigned int>(std::max(1, std::atoi(argv[++i])));
+        } else if (arg == "--lexicon" && i + 1 < argc) {
+            lexiconFile = argv[++i];
+        } else if (arg == "--words" && i + 1 < argc) {
+            wordLists.push_back(argv[++i]);
+        } else if (arg == "--bingo-bonus" && i + 1 < argc) {
+            bingoBonus = std::atoi(argv[++i]);
+        } else if (arg == "--output" && i + 1 < argc) {
+            outputFile = argv[++i];
+        } else if (arg == "-" || arg.compare(0, 2, "--") != 0) {
+            archives.push_back(arg);
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--threads n] [--lexicon file.lex | --words list.txt ...] [--bingo-bonus n]"
+                      << " [--output results.tsv] [archive.gcg ... | -]" << std::endl;
+            return 1;
+        }
+    }
+    if (archives.empty()) archives.push_back("-");
+    if (wordLists.empty()) {
+        wordLists = {"src/Constant/word_bank.txt", "src/Constant/enable1.txt"};
+    }
+
+    // Informational logging goes to stdout, which may be carrying the results
+    Logger::instance().setLevel(LogLevel::WARN);
+
+    // Only membership is needed, so a compiled lexicon is the fastest start
+    Dictionary dictionary;
+    const bool loaded = !lexiconFile.empty() ? dictionary.loadFromLexicon(lexiconFile)
+                                             : dictionary.loadFromFiles(wordLists);
+    if (!loaded) {
+        std::cerr << "Failed to load the lexicon" << std::endl;
+        return 1;
+    }
+
+    std::ofstream outputStream;
+    if (!outputFile.empty()) {
+        outputStream.open(outputFile, std::ios::trunc);
+        if (!outputStream.is_open()) {
+            std::cerr << "Error opening output file: " << outputFile << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& output = outputFile.empty() ? std::cout : outputStream;
+    output << "#game\tmove\tplayer\tposition\tword\tverdict\tcomputed\tclaimed\tdetail\n";
+
+    const auto start = std::chrono::steady_clock::now();
+    RefereePool pool(dictionary, bingoBonus, threadCount);
+    size_t submitted = 0;
+    size_t written = 0;
+    size_t skipped = 0;
+    size_t unreadable = 0;
+    bool ok = true;
+    for (const std::string& archive : archives) {
+        std::ifstream file;
+        if (archive != "-") {
+            file.open(archive);
+            if (!file.is_open()) {
+                std::cerr << "Error opening GCG archive: " << archive << std::endl;
+                ++unreadable;
+                continue;
+            }
+        }
+
+        GcgReader reader(archive == "-" ? std::cin : file);
+        GcgGame game;
+        while (ok && reader.readGame(game)) {
+            pool.submit(submitted++, std::move(game));
+            game = GcgGame();
+            ok = pool.writeFinished(output, written, submitted - written >= MAX_IN_FLIGHT);
+        }
+        skipped += reader.getSkippedGames();
+    }
+    while (ok && written < submitted) {
+        ok = pool.writeFinished(output, written, true);
+    }
+    pool.finish();
+    output.flush();
+    if (!ok || !output) {
+        std::cerr << "Error writing results" << (outputFile.empty() ? "" : ": " + outputFile) << std::endl;
+        return 1;
+    }
+
+    // The reader's warnings about skipped games go through the async logger
+    Logger::instance().flush();
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    uint64_t moves = 0;
+    for (size_t v = 0; v < VERDICT_COUNT; ++v) moves += pool.getTally(static_cast<Verdict>(v));
+    const uint64_t plays = moves - pool.getTally(Verdict::NOT_A_PLAY);
+
+    std::cerr << "Judged " << submitted << " games (" << moves << " moves, " << plays << " plays) in "
+              << seconds << " s with " << threadCount << " threads; skipped " << skipped << " malformed\n";
+    for (size_t v = 0; v + 1 < VERDICT_COUNT; ++v) {
+        std::cerr << "  " << VERDICT_NAMES[v] << ": " << pool.getTally(static_cast<Verdict>(v)) << "\n";
+    }
+    std::cerr.flush();
+
+    // A nonzero status lets scripts gate on a clean archive. Games the reader
+    // dropped (a play through an empty square, say) are failed claims too.
+    if (unreadable > 0) return 1;
+    return (plays == pool.getTally(Verdict::OK) && skipped == 0) ? 0 : 2;
+}
\ No newline at end of file
@@ -0,0 +1,727 @@
+#include "../src/Core/Dictionary.hpp"
+#include "../src/Core/GameRecord.hpp"
+#include "../src/Core/MoveGenerator.hpp"
+#include "../src/Core/SavedGame.hpp"
+#include "../src/Server/Protocol.hpp"
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fcntl.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <string>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// Load generator and latency benchmark for scrabble_server. Usage:
+//     scrabble_loadgen [--host addr] [--port n | --unix path] [--clients n] [--matches n]
+//                      [--threads n] [--script games.scrb] [--seed n] [--hdr file]
+//                      [word_list.txt ...]
+// Opens `clients` connections, two per match, and plays `matches` games of
+// legal moves from the move generator, picked at random among the best few.
+// With --script the recorded games are replayed instead (seeded records
+// only), switching to generated moves once the server's game departs from
+// the record. One thread owns every connection; moves are generated on
+// `threads` more, so the server can be pushed past what one core generates
+// without the generator's time showing up as latency.
+//
+// Latency runs from sending a request to reading its reply and is reported
+// as percentiles; --hdr writes the move latency distribution in
+// HdrHistogram's percentile format for plotting.
+
+typedef std::chrono::steady_clock Clock;
+
+static const size_t TOP_MOVES = 8;      // random games pick among these
+static const int REPLY_TIMEOUT_MS = 10000;
+
+// Log-linear buckets in the style of HdrHistogram: exact below 64 ns, then
+// 32 buckets per power of two, so a value is never more than 1/32 (about
+// 3%) below its bucket's upper bound. Values are nanoseconds.
+class LatencyHistogram {
+private:
+    static const int SUB_BITS = 6;
+    static const int SUB_COUNT = 1 << SUB_BITS;
+    static const int HALF_COUNT = SUB_COUNT / 2;
+    static const int BUCKETS = SUB_COUNT + (64 - SUB_BITS) * HALF_COUNT;
+
+    std::vector<uint64_t> counts;
+    uint64_t total;
+    uint64_t maxValue;
+    double sum;
+
+    static int bucketOf(uint64_t value) {
+        if (value < static_cast<uint64_t>(SUB_COUNT)) return static_cast<int>(value);
+        const int shift = 63 - __builtin_clzll(value) - (SUB_BITS - 1);
+        return SUB_COUNT + (shift - 1) * HALF_COUNT + static_cast<int>((value >> shift) - HALF_COUNT);
+    }
+
+    static uint64_t highestIn(int bucket) {
+        if (bucket < SUB_COUNT) return static_cast<uint64_t>(bucket);
+        const int shift = (bucket - SUB_COUNT) / HALF_COUNT + 1;
+        const uint64_t sub = static_cast<uint64_t>((bucket - SUB_COUNT) % HALF_COUNT + HALF_COUNT);
+        return ((sub + 1) << shift) - 1;
+    }
+
+public:
+    LatencyHistogram() : counts(BUCKETS, 0), total(0), maxValue(0), sum(0.0) {}
+
+    void record(uint64_t nanos) {
+        ++counts[bucketOf(nanos)];
+        ++total;
+        maxValue = std::max(maxValue, nanos);
+        sum += static_cast<double>(nanos);
+    }
+
+    void merge(const LatencyHistogram& other) {
+        for (int i = 0; i < BUCKETS; ++i) counts[i] += other.counts[i];
+        total += other.total;
+        maxValue = std::max(maxValue, other.maxValue);
+        sum += other.sum;
+    }
+
+    uint64_t getCount() const {
+        return total;
+    }
+
+    uint64_t getMax() const {
+        return maxValue;
+    }
+
+    double getMean() const {
+        return total ? sum / static_cast<double>(total) : 0.0;
+    }
+
+    // Upper bound of the bucket holding the value at `percentile` (0-100)
+    uint64_t valueAt(double percentile) const {
+        if (total == 0) return 0;
+        const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * total)));
+        uint64_t seen = 0;
+        for (int i = 0; i < BUCKETS; ++i) {
+            seen += counts[i];
+            if (seen >= rank) return std::min(highestIn(i), maxValue);
+        }
+        return maxValue;
+    }
+
+    // One row per occupied bucket, values in milliseconds
+    void writePercentiles(std::ostream& out) const {
+        out << "       Value     Percentile TotalCount 1/(1-Percentile)\n\n";
+        uint64_t seen = 0;
+        for (int i = 0; i < BUCKETS && seen < total; ++i) {
+            if (counts[i] == 0) continue;
+            seen += counts[i];
+            const double fraction = static_cast<double>(seen) / static_cast<double>(total);
+            out << std::fixed << std::setw(12) << std::setprecision(3) << std::min(highestIn(i), maxValue) / 1e6
+                << ' ' << std::setprecision(12) << fraction << ' ' << std::setw(10) << seen;
+            if (seen < total) out << ' ' << std::setw(14) << std::setprecision(2) << 1.0 / (1.0 - fraction);
+            out << '\n';
+        }
+        out << std::setprecision(3) << "#[Mean    = " << std::setw(12) << getMean() / 1e6
+            << ", Max            = " << std::setw(12) << maxValue / 1e6 << "]\n"
+            << "#[Total count    = " << std::setw(12) << total << "]\n";
+    }
+};
+
+struct LoadStats {
+    uint64_t matches = 0;
+    uint64_t requests = 0;
+    uint64_t plays = 0;
+    uint64_t rejected = 0;
+    uint64_t scriptedMoves = 0;
+    uint64_t divergences = 0;
+    uint64_t positions = 0;          // move generator runs
+    uint64_t generationNanos = 0;
+    LatencyHistogram moveLatency;    // PLAY and PASS
+    LatencyHistogram setupLatency;   // CREATE and JOIN
+};
+
+struct LoadOptions {
+    std::string host = "127.0.0.1";
+    int port = 7070;
+    std::string unixPath;
+    size_t clients = 200;
+    size_t matches = 1000;
+    size_t threads = std::max(1u, std::thread::hardware_concurrency() / 2);
+    uint32_t seed = 1;
+};
+
+static int connectToServer(const LoadOptions& options) {
+    int fd = -1;
+    if (!options.unixPath.empty()) {
+        sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, options.unixPath.c_str(), sizeof(address.sun_path) - 1);
+        fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd >= 0 && connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+            close(fd);
+            fd = -1;
+        }
+    } else {
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<uint16_t>(options.port));
+        inet_pton(AF_INET, options.host.c_str(), &address.sin_addr);
+        fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd >= 0 && connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+            close(fd);
+            fd = -1;
+        }
+        const int enable = 1;
+        if (fd >= 0) setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+    }
+    if (fd >= 0) fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    return fd;
+}
+
+// A position waiting for the move generator, and the move it chose
+struct TurnJob {
+    size_t slot;
+    uint64_t game;      // tells a stale answer from one for the current match
+    int seat;
+    MatchState state;
+};
+
+struct TurnResult {
+    size_t slot;
+    uint64_t game;
+    int seat;
+    std::vector<PlacedTile> tiles;     // empty: pass
+    uint64_t nanos;
+};
+
+// Move generation runs on its own threads and wakes the event loop through
+// an eventfd, so a slow position never delays reading and timing replies.
+class MovePool {
+private:
+    const Dictionary& dictionary;
+    int wakeFd;
+    std::mutex mutex;
+    std::condition_variable jobReady;
+    std::deque<TurnJob> jobs;
+    std::vector<TurnResult> results;
+    bool stopping;
+    std::vector<std::thread> threads;
+
+    void work(uint64_t rngState) {
+        MoveGenerator generator(dictionary);
+        Board board;
+        std::vector<Tile> rack;
+        std::vector<GeneratedMove> moves;
+        while (true) {
+            TurnJob job;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                jobReady.wait(lock, [this] { return stopping || !jobs.empty(); });
+                if (stopping) return;
+                job = jobs.front();
+                jobs.pop_front();
+            }
+
+            const Clock::time_point start = Clock::now();
+            board.clear();
+            for (int square = 0; square < Rules::BOARD_SIZE * Rules::BOARD_SIZE; ++square) {
+                if (job.state.board[square]) {
+                    board.placeTile(square / Rules::BOARD_SIZE, square % Rules::BOARD_SIZE,
+                                    SavedGame::decodeTile(job.state.board[square]));
+                }
+            }
+            rack.clear();
+            for (int i = 0; i < job.state.rackSize; ++i) rack.push_back(SavedGame::decodeTile(job.state.rack[i]));
+            generator.generate(board, rack, moves, TOP_MOVES);
+
+            TurnResult result = {job.slot, job.game, job.seat, {}, 0};
+            if (!moves.empty()) result.tiles = moves[Rules::nextRandom(rngState) % moves.size()].tiles;
+            result.nanos = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                results.push_back(std::move(result));
+            }
+            const uint64_t one = 1;
+            if (write(wakeFd, &one, sizeof(one)) < 0) {
+                // The counter only saturates; the loop drains every result it wakes for
+            }
+        }
+    }
+
+public:
+    MovePool(const Dictionary& dictionary, size_t threadCount, uint32_t seed)
+        : dictionary(dictionary), wakeFd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)), stopping(false) {
+        for (size_t i = 0; i < threadCount; ++i) {
+            const uint64_t rngState = seed ^ (0x9E3779B97F4A7C15ULL * (i + 1));
+            threads.emplace_back([this, rngState] { work(rngState); });
+        }
+    }
+
+    ~MovePool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        jobReady.notify_all();
+        for (std::thread& thread : threads) thread.join();
+        if (wakeFd >= 0) close(wakeFd);
+    }
+
+    int getWakeFd() const {
+        return wakeFd;
+    }
+
+    void submit(const TurnJob& job) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            jobs.push_back(job);
+        }
+        jobReady.notify_one();
+    }
+
+    // Swaps the finished results into `out`
+    void takeResults(std::vector<TurnResult>& out) {
+        uint64_t count = 0;
+        if (read(wakeFd, &count, sizeof(count)) < 0) {
+            // Nothing pending; results may still have arrived before the read
+        }
+        out.clear();
+        std::lock_guard<std::mutex> lock(mutex);
+        out.swap(results);
+    }
+};
+
+// The event loop: every connection, every reply and every timing
+class LoadGenerator {
+private:
+    static const uint64_t WAKE_EVENT = UINT64_MAX;
+
+    struct Client {
+        int fd;
+        int seat;
+        std::vector<uint8_t> input;
+        std::vector<uint8_t> output;
+        size_t outputSent;
+        bool awaitingReply;
+        bool thinking;           // a TurnJob is out for this seat
+        MessageType pending;
+        Clock::time_point sentAt;
+        Clock::time_point receivedAt;
+        MatchState state;
+    };
+
+    struct Slot {
+        Client clients[2];
+        uint64_t game;
+        const GameRecord* script;    // null once the game leaves the record
+        size_t scriptMove;
+    };
+
+    const LoadOptions& options;
+    const std::vector<GameRecord>& scripts;
+    MovePool& pool;
+    int epollFd;
+    uint64_t nextGame;
+    std::vector<Slot> slots;
+    std::vector<PlacedTile> tiles;
+    std::vector<TurnResult> results;
+    LoadStats stats;
+
+    bool startMatch(size_t slotIndex) {
+        Slot& slot = slots[slotIndex];
+        slot.game = nextGame++;
+        slot.script = scripts.empty() ? nullptr : &scripts[slot.game % scripts.size()];
+        slot.scriptMove = 0;
+        const uint32_t seed = slot.script ? slot.script->seed : options.seed + static_cast<uint32_t>(slot.game);
+
+        for (int seat = 0; seat < 2; ++seat) {
+            Client& client = slot.clients[seat];
+            client.fd = connectToServer(options);
+            client.seat = seat;
+            client.input.clear();
+            client.output.clear();
+            client.outputSent = 0;
+            client.awaitingReply = false;
+            client.thinking = false;
+            if (client.fd < 0) {
+                std::cerr << "Could not connect: " << std::strerror(errno) << std::endl;
+                return false;
+            }
+            epoll_event event = {};
+            event.events = EPOLLIN;
+            event.data.u64 = slotIndex * 2 + seat;
+            epoll_ctl(epollFd, EPOLL_CTL_ADD, client.fd, &event);
+        }
+        Protocol::appendCreate(slot.clients[0].output, seed);
+        sent(slot.clients[0], MessageType::CREATE);
+        return true;
+    }
+
+    void closeSlot(Slot& slot) {
+        for (Client& client : slot.clients) {
+            if (client.fd < 0) continue;
+            epoll_ctl(epollFd, EPOLL_CTL_DEL, client.fd, nullptr);
+            close(client.fd);
+            client.fd = -1;
+        }
+    }
+
+    void sent(Client& client, MessageType type) {
+        client.awaitingReply = true;
+        client.pending = type;
+        client.sentAt = Clock::now();
+        ++stats.requests;
+        while (client.outputSent < client.output.size()) {
+            const ssize_t written = send(client.fd, client.output.data() + client.outputSent,
+                                         client.output.size() - client.outputSent, MSG_NOSIGNAL);
+            if (written <= 0) break;
+            client.outputSent += static_cast<size_t>(written);
+        }
+        if (client.outputSent == client.output.size()) {
+            client.output.clear();
+            client.outputSent = 0;
+        }
+    }
+
+    void sendPlay(Client& client, const std::vector<PlacedTile>& play) {
+        ++stats.plays;
+        Protocol::appendPlay(client.output, play);
+        sent(client, MessageType::PLAY);
+    }
+
+    void sendPass(Client& client) {
+        Protocol::appendRequest(client.output, MessageType::PASS);
+        sent(client, MessageType::PASS);
+    }
+
+    // The next recorded move, if it is this seat's and can be sent as is
+    bool takeScriptedTurn(Slot& slot, Client& client) {
+        const GameRecord& record = *slot.script;
+        while (slot.scriptMove < record.moves.size() && record.moves[slot.scriptMove].type != RecordedMoveType::PLAY &&
+               record.moves[slot.scriptMove].type != RecordedMoveType::PASS) {
+            ++slot.scriptMove;
+        }
+        if (slot.scriptMove == record.moves.size()) return false;
+
+        const RecordedMove& move = record.moves[slot.scriptMove++];
+        if (move.player != client.seat) return false;
+        if (move.type == RecordedMoveType::PASS) {
+            ++stats.scriptedMoves;
+            sendPass(client);
+            return true;
+        }
+
+        // A damaged script is abandoned rather than trusted to stay in bounds
+        if (move.tileCount > RecordedMove::MAX_TILES) return false;
+        tiles.clear();
+        for (int i = 0; i < move.tileCount; ++i) {
+            if (move.squares[i] >= Rules::BOARD_SIZE * Rules::BOARD_SIZE) return false;
+            // Recorded blanks may not say which letter they stood for
+            if (move.letters[i] < 'A' || move.letters[i] > 'Z') return false;
+            tiles.push_back({static_cast<uint8_t>(move.squares[i] / Rules::BOARD_SIZE),
+                             static_cast<uint8_t>(move.squares[i] % Rules::BOARD_SIZE), move.letters[i],
+                             ((move.blankMask >> i) & 1) != 0});
+        }
+        ++stats.scriptedMoves;
+        sendPlay(client, tiles);
+        return true;
+    }
+
+    void takeTurn(size_t slotIndex, Client& client) {
+        Slot& slot = slots[slotIndex];
+        if (slot.script) {
+            if (takeScriptedTurn(slot, client)) return;
+            slot.script = nullptr;
+            ++stats.divergences;
+        }
+        client.thinking = true;
+        pool.submit({slotIndex, slot.game, client.seat, client.state});
+    }
+
+    void applyResults() {
+        pool.takeResults(results);
+        for (const TurnResult& result : results) {
+            stats.generationNanos += result.nanos;
+            ++stats.positions;
+
+            Slot& slot = slots[result.slot];
+            Client& client = slot.clients[result.seat];
+            if (slot.game != result.game || client.fd < 0) continue;
+            client.thinking = false;
+            if (result.tiles.empty()) {
+                sendPass(client);
+            } else {
+                sendPlay(client, result.tiles);
+            }
+        }
+    }
+
+    void recordReply(Client& client) {
+        const uint64_t nanos = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(client.receivedAt - client.sentAt).count());
+        const bool move = client.pending == MessageType::PLAY || client.pending == MessageType::PASS;
+        (move ? stats.moveLatency : stats.setupLatency).record(nanos);
+        client.awaitingReply = false;
+    }
+
+    // Returns false once the match is over
+    bool handleMessage(size_t slotIndex, Client& client, const uint8_t* payload, size_t size) {
+        Slot& slot = slots[slotIndex];
+        const MessageType type = static_cast<MessageType>(payload[0]);
+        if (type == MessageType::SEATED) {
+            uint32_t matchId = 0;
+            uint8_t seat = 0;
+            Protocol::parseSeated(payload, size, matchId, seat);
+            recordReply(client);
+            if (seat == 0) {
+                Protocol::appendJoin(slot.clients[1].output, matchId);
+                sent(slot.clients[1], MessageType::JOIN);
+            }
+        } else if (type == MessageType::RESULT) {
+            MessageType request;
+            uint8_t status = 0;
+            int score = 0;
+            Protocol::parseResult(payload, size, request, status, score);
+            recordReply(client);
+            if (status != static_cast<uint8_t>(MoveStatus::OK) && request == MessageType::PLAY) {
+                // Still our turn: a scripted game has left the record; a generated move should never get here
+                ++stats.rejected;
+                if (slot.script) {
+                    slot.script = nullptr;
+                    ++stats.divergences;
+                    takeTurn(slotIndex, client);
+                } else {
+                    sendPass(client);
+                }
+            }
+        } else if (type == MessageType::STATE) {
+            if (!Protocol::parseState(payload, size, client.state)) return true;
+            if (client.state.over) return false;
+            if (client.state.toMove == client.seat && !client.awaitingReply && !client.thinking) {
+                takeTurn(slotIndex, client);
+            }
+        }
+        return true;
+    }
+
+    // Returns false once the match is over
+    bool processInput(size_t slotIndex, Client& client) {
+        size_t offset = 0;
+        bool open = true;
+        while (open) {
+            const size_t frame = Protocol::frameSize(client.input.data() + offset, client.input.size() - offset);
+            if (frame == 0) break;
+            if (frame == SIZE_MAX) return false;
+            open = handleMessage(slotIndex, client, client.input.data() + offset + Protocol::HEADER_BYTES,
+                                 frame - Protocol::HEADER_BYTES);
+            offset += frame;
+        }
+        client.input.erase(client.input.begin(), client.input.begin() + offset);
+        return open;
+    }
+
+public:
+    LoadGenerator(const LoadOptions& options, const std::vector<GameRecord>& scripts, MovePool& pool)
+        : options(options), scripts(scripts), pool(pool), epollFd(epoll_create1(EPOLL_CLOEXEC)), nextGame(0) {
+        slots.resize(std::max<size_t>(1, std::min(options.clients / 2, options.matches)));
+        for (Slot& slot : slots) {
+            for (Client& client : slot.clients) client.fd = -1;
+        }
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.u64 = WAKE_EVENT;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, pool.getWakeFd(), &event);
+    }
+
+    ~LoadGenerator() {
+        for (Slot& slot : slots) closeSlot(slot);
+        if (epollFd >= 0) close(epollFd);
+    }
+
+    bool run() {
+        size_t active = 0;
+        for (size_t i = 0; i < slots.size() && nextGame < options.matches; ++i, ++active) {
+            if (!startMatch(i)) return false;
+        }
+
+        epoll_event events[256];
+        while (active > 0) {
+            const int count = epoll_wait(epollFd, events, 256, REPLY_TIMEOUT_MS);
+            if (count < 0 && errno == EINTR) continue;
+            if (count <= 0) {
+                std::cerr << "Server stopped answering" << std::endl;
+                return false;
+            }
+
+            // Read everything first so replies are timed before any of them is handled
+            bool woken = false;
+            for (int i = 0; i < count; ++i) {
+                if (events[i].data.u64 == WAKE_EVENT) {
+                    woken = true;
+                    continue;
+                }
+                Client& client = slots[events[i].data.u64 / 2].clients[events[i].data.u64 % 2];
+                if (client.fd < 0) continue;
+                uint8_t buffer[16 * 1024];
+                const ssize_t received = recv(client.fd, buffer, sizeof(buffer), 0);
+                client.receivedAt = Clock::now();
+                if (received > 0) {
+                    client.input.insert(client.input.end(), buffer, buffer + received);
+                } else if (received == 0 || (errno != EAGAIN && errno != EINTR)) {
+                    std::cerr << "Server closed a connection" << std::endl;
+                    return false;
+                }
+            }
+
+            for (int i = 0; i < count; ++i) {
+                if (events[i].data.u64 == WAKE_EVENT) continue;
+                const size_t slotIndex = events[i].data.u64 / 2;
+                Slot& slot = slots[slotIndex];
+                Client& client = slot.clients[events[i].data.u64 % 2];
+                if (client.fd < 0 || processInput(slotIndex, client)) continue;
+
+                closeSlot(slot);
+                ++stats.matches;
+                --active;
+                if (nextGame < options.matches) {
+                    if (!startMatch(slotIndex)) return false;
+                    ++active;
+                }
+            }
+            if (woken) applyResults();
+        }
+        return true;
+    }
+
+    const LoadStats& getStats() const {
+        return stats;
+    }
+};
+
+static void printLatency(const char* label, const LatencyHistogram& histogram) {
+    std::cout << std::left << std::setw(8) << label << std::right << std::fixed << std::setprecision(1);
+    for (double percentile : {50.0, 90.0, 99.0, 99.9}) {
+        std::cout << std::setw(10) << histogram.valueAt(percentile) / 1e3;
+    }
+    std::cout << std::setw(10) << histogram.getMax() / 1e3 << std::setw(10) << histogram.getMean() / 1e3
+              << std::setw(10) << histogram.getCount() << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    LoadOptions options;
+    std::string scriptFile;
+    std::string hdrFile;
+    std::vector<std::string> wordLists;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--host" && i + 1 < argc) {
+            options.host = argv[++i];
+        } else if (arg == "--port" && i + 1 < argc) {
+            options.port = std::atoi(argv[++i]);
+        } else if (arg == "--unix" && i + 1 < argc) {
+            options.unixPath = argv[++i];
+        } else if (arg == "--clients" && i + 1 < argc) {
+            options.clients = std::max<size_t>(2, std::strtoull(argv[++i], nullptr, 10));
+        } else if (arg == "--matches" && i + 1 < argc) {
+            options.matches = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            options.threads = std::max<size_t>(1, std::strtoull(argv[++i], nullptr, 10));
+        } else if (arg == "--script" && i + 1 < argc) {
+            scriptFile = argv[++i];
+        } else if (arg == "--seed" && i + 1 < argc) {
+            options.seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--hdr" && i + 1 < argc) {
+            hdrFile = argv[++i];
+        } else if (arg.compare(0, 2, "--") != 0) {
+            wordLists.push_back(arg);
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--host addr] [--port n | --unix path] [--clients n]"
+                      << " [--matches n] [--threads n] [--script games.scrb] [--seed n] [--hdr file]"
+                      << " [word_list.txt ...]" << std::endl;
+            return 1;
+        }
+    }
+    if (wordLists.empty()) {
+        wordLists = {"src/Constant/word_bank.txt", "src/Constant/enable1.txt"};
+    }
+
+    std::vector<GameRecord> scripts;
+    if (!scriptFile.empty()) {
+        std::vector<GameRecord> records;
+        if (!GameRecord::readFile(scriptFile, records)) return 1;
+        // Imported games were not dealt from the seeded bag, so the server's racks would differ
+        for (GameRecord& record : records) {
+            if (!(record.flags & GameRecord::FLAG_EXTERNAL_RACKS)) scripts.push_back(std::move(record));
+        }
+        if (scripts.empty()) {
+            std::cerr << "No seeded games to replay in " << scriptFile << std::endl;
+            return 1;
+        }
+    }
+
+    Dictionary dictionary;
+    if (!dictionary.loadFromFiles(wordLists)) {
+        std::cerr << "Failed to load word lists" << std::endl;
+        return 1;
+    }
+
+    rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+
+    MovePool pool(dictionary, options.threads, options.seed);
+    LoadGenerator generator(options, scripts, pool);
+    const Clock::time_point start = Clock::now();
+    const bool finished = generator.run();
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    const LoadStats& stats = generator.getStats();
+    const uint64_t moves = stats.moveLatency.getCount();
+
+    std::cout << stats.matches << " matches, " << moves << " moves (" << stats.plays << " plays, " << stats.rejected
+              << " rejected), " << stats.requests << " requests in " << std::fixed << std::setprecision(2)
+              << seconds << " s, " << options.threads << " move thread(s)" << std::endl;
+    if (!scripts.empty()) {
+        std::cout << stats.scriptedMoves << " scripted moves, " << stats.divergences << " games left their record"
+                  << std::endl;
+    }
+    std::cout << std::setprecision(1) << stats.matches / seconds << " matches/s, " << moves / seconds
+              << " moves/s, " << stats.requests / seconds << " requests/s" << std::endl;
+    if (stats.positions > 0) {
+        std::cout << std::setprecision(2) << "move generation " << stats.generationNanos / 1e6 / stats.positions
+                  << " ms mean over " << stats.positions << " positions" << std::endl;
+    }
+    std::cout << std::left << std::setw(8) << "us" << std::right;
+    for (const char* column : {"p50", "p90", "p99", "p99.9", "max", "mean", "count"}) {
+        std::cout << std::setw(10) << column;
+    }
+    std::cout << std::endl;
+    printLatency("move", stats.moveLatency);
+    printLatency("setup", stats.setupLatency);
+
+    if (!hdrFile.empty()) {
+        std::ofstream out(hdrFile);
+        stats.moveLatency.writePercentiles(out);
+        if (!out) {
+            std::cerr << "Error writing latency histogram: " << hdrFile << std::endl;
+            return 1;
+        }
+    }
+
+    return finished ? 0 : 1;
+}
\ No newline at end of file